@@ -61,6 +61,7 @@ function(set_options)
     option(OPTION_TOOLS_ONLY "Build only tools target" OFF)
     option(OPTION_DOCS_ONLY "Build only docs target" OFF)
     option(OPTION_ALLOW_INVALID_SIGNATURE "Allow loading of content with invalid signatures" OFF)
+    option(OPTION_BLOCKED_TILE_LAYOUT "Store the map in blocks of 8x8 tiles instead of row by row (experimental)" OFF)
 
     if (OPTION_DOCS_ONLY)
         set(OPTION_TOOLS_ONLY ON PARENT_SCOPE)
@@ -79,6 +80,7 @@ function(show_options)
     message(STATUS "Option Install FHS - ${OPTION_INSTALL_FHS}")
     message(STATUS "Option Use assert - ${OPTION_USE_ASSERTS}")
     message(STATUS "Option Use NSIS - ${OPTION_USE_NSIS}")
+    message(STATUS "Option Blocked Tile Layout - ${OPTION_BLOCKED_TILE_LAYOUT}")
 
     if(OPTION_SURVEY_KEY)
         message(STATUS "Option Survey Key - USED")
@@ -101,6 +103,10 @@ function(add_definitions_based_on_options)
         add_definitions(-DDEDICATED)
     endif()
 
+    if(OPTION_BLOCKED_TILE_LAYOUT)
+        add_definitions(-DWITH_BLOCKED_TILE_LAYOUT)
+    endif()
+
     if(OPTION_USE_ASSERTS)
         add_definitions(-DWITH_ASSERT)
     else()
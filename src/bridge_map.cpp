@@ -52,6 +52,42 @@ TileIndex GetSouthernBridgeEnd(TileIndex t)
 }
 
 
+/** Northern and southern ends of the bridge last looked up by #GetCachedBridgeEnds, per axis. */
+static std::array<std::pair<TileIndex, TileIndex>, AXIS_END> _cached_bridge_ends = {{{INVALID_TILE, INVALID_TILE}, {INVALID_TILE, INVALID_TILE}}};
+
+/**
+ * Finds both ends of a bridge starting at a middle tile, reusing the ends found last time.
+ * Drawing visits the middle tiles of a bridge one after another, so searching for each
+ * of them would walk the bridge again and again. Bridges on the same axis never
+ * overlap, so any tile strictly between the cached ends is under that same bridge.
+ * @param t the bridge tile to find the bridge ramps for
+ * @return the northern and southern bridge ends
+ * @note The cache is only valid while the map does not change, so it must be
+ *       invalidated with #InvalidateCachedBridgeEnds before it is used again.
+ */
+std::pair<TileIndex, TileIndex> GetCachedBridgeEnds(TileIndex t)
+{
+	Axis axis = GetBridgeAxis(t);
+	auto &[north, south] = _cached_bridge_ends[axis];
+
+	if (north != INVALID_TILE) {
+		bool between = (axis == AXIS_X)
+			? TileY(t) == TileY(north) && TileX(north) < TileX(t) && TileX(t) < TileX(south)
+			: TileX(t) == TileX(north) && TileY(north) < TileY(t) && TileY(t) < TileY(south);
+		if (between) return {north, south};
+	}
+
+	north = GetNorthernBridgeEnd(t);
+	south = GetSouthernBridgeEnd(t);
+	return {north, south};
+}
+
+/** Forget the bridge ends remembered by #GetCachedBridgeEnds. */
+void InvalidateCachedBridgeEnds()
+{
+	_cached_bridge_ends.fill({INVALID_TILE, INVALID_TILE});
+}
+
 /**
  * Starting at one bridge end finds the other bridge end
  * @param tile the bridge ramp tile to find the other bridge ramp for
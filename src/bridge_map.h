@@ -74,6 +74,8 @@ inline Axis GetBridgeAxis(Tile t)
 TileIndex GetNorthernBridgeEnd(TileIndex t);
 TileIndex GetSouthernBridgeEnd(TileIndex t);
 TileIndex GetOtherBridgeEnd(TileIndex t);
+std::pair<TileIndex, TileIndex> GetCachedBridgeEnds(TileIndex t);
+void InvalidateCachedBridgeEnds();
 
 int GetBridgeHeight(TileIndex tile);
 /**
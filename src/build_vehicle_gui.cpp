@@ -1182,6 +1182,7 @@ struct BuildVehicleWindow : Window {
 
 	StringFilter string_filter{}; ///< Filter for vehicle name
 	QueryString vehicle_editbox; ///< Filter editbox
+	FlatMap<EngineID, std::pair<std::string, std::optional<std::string>>> cm_filter_texts; ///< CM Engine names and NewGRF extra texts, kept while the filter text is edited.
 
 	std::pair<WidgetID, WidgetID> badge_filters{}; ///< First and last widgets IDs of badge filters.
 	BadgeFilterChoices badge_filter_choices{};
@@ -1381,12 +1382,17 @@ struct BuildVehicleWindow : Window {
 		/* Do not filter if the filter text box is empty */
 		if (this->string_filter.IsEmpty()) return true;
 
+		/* CM: Formatting the name and running the extra text callback for every engine on
+		 * each key press is slow for large sets, so remember them until the data changes. */
+		auto it = this->cm_filter_texts.find(e->index);
+		const auto &[name, text] = (it != this->cm_filter_texts.end()) ? it->second :
+				(this->cm_filter_texts[e->index] = {GetString(STR_ENGINE_NAME, PackEngineNameDParam(e->index, EngineNameContext::PurchaseList)), GetNewGRFAdditionalText(e->index)});
+
 		/* Filter engine name */
 		this->string_filter.ResetState();
-		this->string_filter.AddLine(GetString(STR_ENGINE_NAME, PackEngineNameDParam(e->index, EngineNameContext::PurchaseList)));
+		this->string_filter.AddLine(name);
 
 		/* Filter NewGRF extra text */
-		auto text = GetNewGRFAdditionalText(e->index);
 		if (text) this->string_filter.AddLine(*text);
 
 		return this->string_filter.GetState();
@@ -1806,6 +1812,7 @@ struct BuildVehicleWindow : Window {
 			this->sort_criteria = 0;
 			_engine_sort_last_criteria[VEH_ROAD] = 0;
 		}
+		this->cm_filter_texts.clear(); // CM
 		this->eng_list.ForceRebuild();
 	}
 
@@ -2026,7 +2033,9 @@ struct BuildVehicleWindow : Window {
 	{
 		if (wid == WID_BV_FILTER) {
 			this->string_filter.SetFilterTerm(this->vehicle_editbox.text.GetText());
-			this->InvalidateData();
+			/* CM: Only the filter changed, so keep the remembered engine texts. */
+			this->eng_list.ForceRebuild();
+			this->SetDirty();
 		}
 	}
 
@@ -14,10 +14,12 @@
 #include "industry.h"
 #include "roadstop_base.h"
 #include "roadveh.h"
+#include "settings_type.h"
 #include "ship.h"
 #include "station_base.h"
 #include "station_map.h"
 #include "subsidy_func.h"
+#include "timer/timer_game_tick.h"
 #include "town.h"
 #include "train.h"
 #include "vehicle_base.h"
@@ -38,6 +40,8 @@ void CheckCaches()
 	/* Return here so it is easy to add checks that are run
 	 * always to aid testing of caches. */
 	if (_debug_desync_level <= 1) return;
+	/* CM: Optionally only sample the caches, as checking all of them every tick is slow on big maps. */
+	if (TimerGameTick::counter % _settings_client.gui.cm_cache_check_interval != 0) return;
 
 	/* Check the town caches. */
 	std::vector<TownCache> old_town_caches;
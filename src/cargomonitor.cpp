@@ -17,26 +17,31 @@ CargoMonitorMap _cargo_pickups;    ///< Map of monitored pick-ups   to the amoun
 CargoMonitorMap _cargo_deliveries; ///< Map of monitored deliveries to the amount since last query/activation.
 
 /**
- * Helper method for #ClearCargoPickupMonitoring and #ClearCargoDeliveryMonitoring.
  * Clears all monitors that belong to the specified company or all if #INVALID_OWNER
  * is specified as company.
- * @param cargo_monitor_map reference to the cargo monitor map to operate on.
  * @param company company to clear cargo monitors for or #INVALID_OWNER if all cargo monitors should be cleared.
  */
-static void ClearCargoMonitoring(CargoMonitorMap &cargo_monitor_map, CompanyID company = INVALID_OWNER)
+void CargoMonitorMap::Clear(CompanyID company)
 {
 	if (company == INVALID_OWNER) {
-		cargo_monitor_map.clear();
+		for (Shard &shard : this->shards) shard.clear();
 		return;
 	}
 
-	for (auto it = cargo_monitor_map.begin(); it != cargo_monitor_map.end(); /* nothing */) {
-		if (DecodeMonitorCompany(it->first) == company) {
-			it = cargo_monitor_map.erase(it);
-		} else {
-			++it;
-		}
-	}
+	if (company.base() < this->shards.size()) this->shards[company.base()].clear();
+}
+
+/**
+ * Get all monitors ordered by their number, e.g. to write them to a savegame
+ * independent of the order of the hash maps.
+ * @return Pairs of cargo monitor and amount.
+ */
+std::vector<std::pair<CargoMonitorID, OverflowSafeInt32>> CargoMonitorMap::GetSorted() const
+{
+	std::vector<std::pair<CargoMonitorID, OverflowSafeInt32>> result;
+	for (const Shard &shard : this->shards) result.insert(result.end(), shard.begin(), shard.end());
+	std::sort(result.begin(), result.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+	return result;
 }
 
 /**
@@ -46,7 +51,7 @@ static void ClearCargoMonitoring(CargoMonitorMap &cargo_monitor_map, CompanyID c
  */
 void ClearCargoPickupMonitoring(CompanyID company)
 {
-	ClearCargoMonitoring(_cargo_pickups, company);
+	_cargo_pickups.Clear(company);
 }
 
 /**
@@ -56,7 +61,7 @@ void ClearCargoPickupMonitoring(CompanyID company)
  */
 void ClearCargoDeliveryMonitoring(CompanyID company)
 {
-	ClearCargoMonitoring(_cargo_deliveries, company);
+	_cargo_deliveries.Clear(company);
 }
 
 /**
@@ -68,16 +73,17 @@ void ClearCargoDeliveryMonitoring(CompanyID company)
  */
 static int32_t GetAmount(CargoMonitorMap &monitor_map, CargoMonitorID monitor, bool keep_monitoring)
 {
-	CargoMonitorMap::iterator iter = monitor_map.find(monitor);
-	if (iter == monitor_map.end()) {
+	CargoMonitorMap::Shard &shard = monitor_map.GetShard(monitor);
+	CargoMonitorMap::Shard::iterator iter = shard.find(monitor);
+	if (iter == shard.end()) {
 		if (keep_monitoring) {
-			monitor_map.emplace(monitor, 0);
+			shard.emplace(monitor, 0);
 		}
 		return 0;
 	} else {
 		int32_t result = iter->second;
 		iter->second = 0;
-		if (!keep_monitoring) monitor_map.erase(iter);
+		if (!keep_monitoring) shard.erase(iter);
 		return result;
 	}
 }
@@ -123,14 +129,12 @@ void AddCargoDelivery(CargoType cargo_type, CompanyID company, uint32_t amount,
 		switch (src.type) {
 			case SourceType::Industry: {
 				CargoMonitorID num = EncodeCargoIndustryMonitor(company, cargo_type, src.ToIndustryID());
-				CargoMonitorMap::iterator iter = _cargo_pickups.find(num);
-				if (iter != _cargo_pickups.end()) iter->second += amount;
+				_cargo_pickups.AddIfMonitored(num, amount);
 				break;
 			}
 			case SourceType::Town: {
 				CargoMonitorID num = EncodeCargoTownMonitor(company, cargo_type, src.ToTownID());
-				CargoMonitorMap::iterator iter = _cargo_pickups.find(num);
-				if (iter != _cargo_pickups.end()) iter->second += amount;
+				_cargo_pickups.AddIfMonitored(num, amount);
 				break;
 			}
 			default: break;
@@ -142,15 +146,13 @@ void AddCargoDelivery(CargoType cargo_type, CompanyID company, uint32_t amount,
 
 	/* Town delivery. */
 	CargoMonitorID num = EncodeCargoTownMonitor(company, cargo_type, st->town->index);
-	CargoMonitorMap::iterator iter = _cargo_deliveries.find(num);
-	if (iter != _cargo_deliveries.end()) iter->second += amount;
+	_cargo_deliveries.AddIfMonitored(num, amount);
 
 	/* Industry delivery. */
 	for (const auto &i : st->industries_near) {
 		if (i.industry->index != dest) continue;
 		CargoMonitorID num = EncodeCargoIndustryMonitor(company, cargo_type, i.industry->index);
-		CargoMonitorMap::iterator iter = _cargo_deliveries.find(num);
-		if (iter != _cargo_deliveries.end()) iter->second += amount;
+		_cargo_deliveries.AddIfMonitored(num, amount);
 	}
 }
 
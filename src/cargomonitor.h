@@ -15,6 +15,7 @@
 #include "industry.h"
 #include "town.h"
 #include "core/overflowsafe_type.hpp"
+#include <unordered_map>
 
 struct Station;
 
@@ -29,11 +30,6 @@ struct Station;
 typedef uint32_t CargoMonitorID; ///< Type of the cargo monitor number.
 
 /** Map type for storing and updating active cargo monitor numbers and their amounts. */
-typedef std::map<CargoMonitorID, OverflowSafeInt32> CargoMonitorMap;
-
-extern CargoMonitorMap _cargo_pickups;
-extern CargoMonitorMap _cargo_deliveries;
-
 
 /* Constants for encoding and extracting cargo monitors. */
 constexpr uint8_t CCB_TOWN_IND_NUMBER_START = 0; ///< Start bit of the town or industry number.
@@ -139,6 +135,47 @@ inline TownID DecodeMonitorTown(CargoMonitorID num)
 	return static_cast<TownID>(GB(num, CCB_TOWN_IND_NUMBER_START, CCB_TOWN_IND_NUMBER_LENGTH));
 }
 
+/**
+ * Amounts of monitored cargo, kept in a separate hash map per company.
+ * Deliveries find their monitor in constant time, and clearing the monitors
+ * of one company does not have to look at the monitors of the others.
+ */
+class CargoMonitorMap {
+public:
+	using Shard = std::unordered_map<CargoMonitorID, OverflowSafeInt32>; ///< Monitors of a single company.
+
+	/**
+	 * Get the monitors of the company a monitor belongs to.
+	 * @param monitor Cargo monitor to get the shard for.
+	 * @return The monitors of the same company.
+	 */
+	inline Shard &GetShard(CargoMonitorID monitor)
+	{
+		return this->shards[GB(monitor, CCB_COMPANY_START, CCB_COMPANY_LENGTH)];
+	}
+
+	/**
+	 * Add an amount to a monitor, if it is being monitored.
+	 * @param monitor Cargo monitor to add to.
+	 * @param amount Amount of cargo to add.
+	 */
+	inline void AddIfMonitored(CargoMonitorID monitor, uint32_t amount)
+	{
+		Shard &shard = this->GetShard(monitor);
+		auto iter = shard.find(monitor);
+		if (iter != shard.end()) iter->second += amount;
+	}
+
+	void Clear(CompanyID company = INVALID_OWNER);
+	std::vector<std::pair<CargoMonitorID, OverflowSafeInt32>> GetSorted() const;
+
+private:
+	std::array<Shard, 1 << CCB_COMPANY_LENGTH> shards; ///< Monitors, indexed by company.
+};
+
+extern CargoMonitorMap _cargo_pickups;
+extern CargoMonitorMap _cargo_deliveries;
+
 void ClearCargoPickupMonitoring(CompanyID company = INVALID_OWNER);
 void ClearCargoDeliveryMonitoring(CompanyID company = INVALID_OWNER);
 int32_t GetDeliveryAmount(CargoMonitorID monitor, bool keep_monitoring);
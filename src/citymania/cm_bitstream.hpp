@@ -37,8 +37,9 @@ protected:
 	u8vector &f;
 	uint32_t i;
 public:
-	BitIStream(u8vector &data): f(data), i(0) {}
+	BitIStream(u8vector &data, uint32_t offset = 0): f(data), i(offset) {}
 	virtual ~BitIStream(){}
+	uint32_t GetOffset() const { return this->i; }
 	uint32_t ReadBytes(uint amount);
 	uint64_t ReadBytes64(uint amount);
 	Money ReadMoney();
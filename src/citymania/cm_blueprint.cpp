@@ -188,12 +188,16 @@ up<Command> GetBlueprintCommand(TileIndex start, const Blueprint::Item &item) {
     NOT_REACHED();
 }
 
-std::multimap<TileIndex, ObjectTileHighlight> Blueprint::GetTiles(TileIndex tile) {
-    std::multimap<TileIndex, ObjectTileHighlight> res;
-    if (tile == INVALID_TILE) return res;
+/**
+ * Collect the highlights of the blueprint placed at the tile.
+ * @param tile Tile the blueprint is placed at.
+ * @param res Map to add highlights to, reused between calls to avoid allocations.
+ */
+void Blueprint::GetTiles(TileIndex tile, HighlightMap &res) {
+    if (tile == INVALID_TILE) return;
     auto add_tile = [&res](TileIndex tile, const ObjectTileHighlight &ohl) {
         if (tile >= Map::Size()) return;
-        res.emplace(tile, ohl);
+        res.Add(tile, ohl);
     };
 
     std::set<StationID> can_build_station_sign;
@@ -259,7 +263,6 @@ std::multimap<TileIndex, ObjectTileHighlight> Blueprint::GetTiles(TileIndex tile
                 NOT_REACHED();
         }
     }
-    return res;
 }
 
 sp<Blueprint> Blueprint::Rotate() {
@@ -8,6 +8,7 @@
 #include "../network/network_internal.h"
 #include "../network/network_server.h"
 #include "../console_func.h"
+#include "../debug.h"
 #include "../rev.h"
 #include "../strings_func.h"
 
@@ -27,13 +28,159 @@ struct FakeCommand {
     CommandPacket cp;
 };
 
+/* Commands are decoded from the log as replay needs them, keeping at most this many parsed. */
+static const size_t FAKE_COMMANDS_QUEUE_SIZE = 1024;
+
+/* Streaming decoder of a command log file. */
+class CommandLogReader {
+    static const size_t CHUNK_SIZE = 128 * 1024;
+
+    FILE *f = nullptr;
+    lzma_stream lzma = LZMA_STREAM_INIT;
+    lzma_action action = LZMA_RUN;
+    bool stream_end = false;
+    u8vector data;    ///< Decoded data that has not been parsed yet, starting at pos.
+    size_t pos = 0;
+    std::function<void(const std::string &)> error_func;
+    uint8_t inbuf[CHUNK_SIZE];
+
+public:
+    CommandLogReader(FILE *f, std::function<void(const std::string &)> error_func) : f(f), error_func(error_func) {}
+
+    ~CommandLogReader() {
+        lzma_end(&this->lzma);
+        if (this->f != nullptr) std::fclose(this->f);
+    }
+
+    bool Init() {
+        lzma_ret ret = lzma_auto_decoder(&this->lzma, 1 << 28, 0);
+        if (ret != LZMA_OK) {
+            this->error_func(fmt::format("Cannot initialize LZMA decompressor (code {})", ret));
+            return false;
+        }
+        return true;
+    }
+
+    /* Decode up to another chunk of data. Returns false when there is nothing more to decode. */
+    bool Fill() {
+        if (this->stream_end) return false;
+
+        /* Drop the data that has been parsed already. */
+        this->data.erase(this->data.begin(), this->data.begin() + this->pos);
+        this->pos = 0;
+
+        size_t old_size = this->data.size();
+        this->data.resize(old_size + CHUNK_SIZE);
+        this->lzma.next_out = &this->data[old_size];
+        this->lzma.avail_out = CHUNK_SIZE;
+
+        lzma_ret ret;
+        do {
+            if (this->lzma.avail_in == 0 && !std::feof(this->f)) {
+                this->lzma.next_in = this->inbuf;
+                this->lzma.avail_in = std::fread((char *)this->inbuf, 1, sizeof(this->inbuf), this->f);
+
+                if (std::ferror(this->f)) {
+                    this->error_func(fmt::format("Error reading command log: {}", std::strerror(errno)));
+                    this->stream_end = true;
+                    break;
+                }
+
+                if (std::feof(this->f)) this->action = LZMA_FINISH;
+            }
+
+            ret = lzma_code(&this->lzma, this->action);
+        } while (ret == LZMA_OK && this->lzma.avail_out != 0);
+
+        if (ret != LZMA_OK) {
+            if (ret != LZMA_STREAM_END) this->error_func(fmt::format("LZMA decompressor returned error code {}", ret));
+            this->stream_end = true;
+        }
+
+        this->data.resize(old_size + CHUNK_SIZE - this->lzma.avail_out);
+        return this->data.size() > old_size;
+    }
+
+    /* Read the log header. Returns false if the log can't be replayed. */
+    bool ReadHeader() {
+        while (this->data.size() < 6) {
+            if (!this->Fill()) {
+                this->error_func("Unexpected end of command data");
+                return false;
+            }
+        }
+
+        auto bs = BitIStream(this->data);
+        auto version = bs.ReadBytes(2);
+        if (version != 2) {
+            this->error_func(fmt::format("Unsupported log file version {}", version));
+            return false;
+        }
+
+        auto openttd_version = bs.ReadBytes(4);
+        if (_openttd_newgrf_version != openttd_version) {
+            this->error_func(fmt::format("OpenTTD version doesn't match: current {}, log file {}",
+                                         _openttd_newgrf_version, openttd_version));
+            return false;
+        }
+        this->pos = bs.GetOffset();
+        return true;
+    }
+
+    /* Parse commands into the queue until it holds count commands. Returns false at the end of the log. */
+    bool Parse(std::queue<FakeCommand> &queue, size_t count) {
+        while (queue.size() < count) {
+            if (this->pos == this->data.size() && !this->Fill()) return false;
+
+            auto bs = BitIStream(this->data, this->pos);
+            FakeCommand fk;
+            try {
+                fk.counter = bs.ReadBytes(4);
+                fk.res = bs.ReadBytes(1);
+                fk.seed = bs.ReadBytes(1);
+                fk.cp.company = (Owner)bs.ReadBytes(1);
+                fk.client_id = bs.ReadBytes(2);
+                fk.cp.cmd = (Commands)bs.ReadBytes(2);
+                fk.cp.data = bs.ReadData();
+                fk.cp.callback = nullptr;
+            } catch (BitIStreamUnexpectedEnd &) {
+                /* The command continues in data that hasn't been decoded yet. */
+                if (this->Fill()) continue;
+                this->error_func("Unexpected end of command data");
+                return false;
+            }
+            this->pos = bs.GetOffset();
+            queue.push(std::move(fk));
+        }
+        return true;
+    }
+};
+
 static std::queue<FakeCommand> _fake_commands;
+static std::unique_ptr<CommandLogReader> _command_log_reader;
 bool _replay_started = false;
 
+/* Outcome counts of the commands replayed since the log was loaded. */
+static struct {
+    bool loaded = false;
+    uint64_t executed = 0;
+    uint64_t rejected = 0;
+    uint64_t mismatched = 0;
+    uint64_t desyncs = 0;
+} _replay_stats;
+
+/* Get the next command to replay, decoding more of the log when the queue ran out. */
+static FakeCommand *PeekFakeCommand() {
+    if (_fake_commands.empty() && _command_log_reader != nullptr) {
+        if (!_command_log_reader->Parse(_fake_commands, FAKE_COMMANDS_QUEUE_SIZE)) _command_log_reader.reset();
+    }
+    return _fake_commands.empty() ? nullptr : &_fake_commands.front();
+}
+
 void SkipFakeCommands(TimerGameTick::TickCounter counter) {
     uint commands_skipped = 0;
 
-    while (!_fake_commands.empty() && _fake_commands.front().counter < counter) {
+    for (FakeCommand *x = PeekFakeCommand(); x != nullptr && x->counter < counter; x = PeekFakeCommand()) {
         _fake_commands.pop();
         commands_skipped++;
     }
@@ -52,12 +199,12 @@ void ExecuteFakeCommands(TimerGameTick::TickCounter counter) {
     }
 
     auto backup_company = _current_company;
-    while (!_fake_commands.empty() && _fake_commands.front().counter <= counter) {
-        auto &x = _fake_commands.front();
+    for (FakeCommand *next = PeekFakeCommand(); next != nullptr && next->counter <= counter; next = PeekFakeCommand()) {
+        auto &x = *next;
 
-        fprintf(stderr, "Executing command: %s(%u) company=%u ... ", GetCommandName(x.cp.cmd), x.cp.cmd, x.cp.company);
         if (x.res == 0) {
-            fprintf(stderr, "REJECTED\n");
+            Debug(misc, 3, "Replay: skipped rejected command {}({}) company={}", GetCommandName(x.cp.cmd), x.cp.cmd, x.cp.company);
+            _replay_stats.rejected++;
             _fake_commands.pop();
             continue;
         }
@@ -76,19 +223,22 @@ void ExecuteFakeCommands(TimerGameTick::TickCounter counter) {
 
         _current_company = (CompanyID)x.cp.company;
         auto res = ExecuteCommand(&x.cp);
+        _replay_stats.executed++;
         if (res.Failed() != (x.res != 1)) {
+            _replay_stats.mismatched++;
             if (!res.Failed()) {
-                fprintf(stderr, "FAIL (Failing command succeeded)\n");
+                fmt::print(stderr, "Command {}({}) company={}: FAIL (Failing command succeeded)\n", GetCommandName(x.cp.cmd), x.cp.cmd, x.cp.company);
             } else if (res.GetErrorMessage() != INVALID_STRING_ID) {
                 auto buf = GetString(res.GetErrorMessage());
-                fprintf(stderr, "FAIL (Successful command failed: %s)\n", buf.c_str());
+                fmt::print(stderr, "Command {}({}) company={}: FAIL (Successful command failed: {})\n", GetCommandName(x.cp.cmd), x.cp.cmd, x.cp.company, buf);
             } else {
-                fprintf(stderr, "FAIL (Successful command failed)\n");
+                fmt::print(stderr, "Command {}({}) company={}: FAIL (Successful command failed)\n", GetCommandName(x.cp.cmd), x.cp.cmd, x.cp.company);
             }
         } else {
-            fprintf(stderr, "OK\n");
+            Debug(misc, 3, "Replay: executed command {}({}) company={}", GetCommandName(x.cp.cmd), x.cp.cmd, x.cp.company);
         }
         if (x.seed != (_random.state[0] & 255)) {
+            _replay_stats.desyncs++;
             fprintf(stderr, "*** DESYNC expected seed %u vs current %u ***\n", x.seed, _random.state[0] & 255);
         }
         _fake_commands.pop();
@@ -96,9 +246,12 @@ void ExecuteFakeCommands(TimerGameTick::TickCounter counter) {
     _current_company = backup_company;
 }
 
-
 void load_replay_commands(std::string_view filename, std::function<void(const std::string &)> error_func) {
     _fake_commands = {};
+    _command_log_reader.reset();
+    _replay_started = false;
+    _replay_stats = {};
+    _replay_stats.loaded = true;
 
     FILE *f = fopen(std::string(filename).c_str(), "rb");
 
@@ -107,95 +260,22 @@ void load_replay_commands(std::string_view filename, std::function<void(const st
         return;
     }
 
-    lzma_stream lzma = LZMA_STREAM_INIT;
-    lzma_ret ret = lzma_auto_decoder(&lzma, 1 << 28, 0);
-    if (ret != LZMA_OK) {
-        error_func(fmt::format("Cannot initialize LZMA decompressor (code {})", ret));
-        return;
-    }
-
-    static const size_t CHUNK_SIZE = 128 * 1024;
-    static uint8_t inbuf[CHUNK_SIZE];
-
-    lzma.next_in = NULL;
-    lzma.avail_in = 0;
-
-    lzma_action action = LZMA_RUN;
-
-    u8vector data(CHUNK_SIZE);
-    size_t bytes_read = 0;
-    lzma.next_out = &data[0];
-    lzma.avail_out = data.size();
-    do {
-        if (lzma.avail_in == 0 && !std::feof(f)) {
-            lzma.next_in = inbuf;
-            lzma.avail_in = std::fread((char *)inbuf, 1, sizeof(inbuf), f);
-
-            if (std::ferror(f)) {
-                error_func(fmt::format("Error reading {}: {}", filename, std::strerror(errno)));
-                return;
-            }
+    auto reader = std::make_unique<CommandLogReader>(f, error_func);
+    if (!reader->Init() || !reader->ReadHeader()) return;
 
-            if (std::feof(f)) action = LZMA_FINISH;
-        }
-
-        ret = lzma_code(&lzma, action);
-
-        if (lzma.avail_out == 0 || ret == LZMA_STREAM_END) {
-            bytes_read += CHUNK_SIZE - lzma.avail_out;
-            data.resize(bytes_read + CHUNK_SIZE);
-            lzma.next_out = &data[bytes_read];
-            lzma.avail_out = CHUNK_SIZE;
-        }
-    } while (ret == LZMA_OK);
-
-    std::fclose(f);
-
-    data.resize(bytes_read);
-
-    if (ret != LZMA_STREAM_END) {
-        error_func(fmt::format("LZMA decompressor returned error code {}", ret));
-        // return;
-    }
-
-    auto bs = BitIStream(data);
-    auto version = bs.ReadBytes(2);
-    if (version != 2) {
-        error_func(fmt::format("Unsupported log file version {}", version));
-        return;
-    }
-
-    auto openttd_version = bs.ReadBytes(4);
-
-    if (_openttd_newgrf_version != openttd_version) {
-        error_func(fmt::format("OpenTTD version doesn't match: current {}, log file {}",
-                               _openttd_newgrf_version, openttd_version));
-        return;
-    }
-    try {
-        while (!bs.eof()) {
-            FakeCommand fk;
-            fk.counter = bs.ReadBytes(4);
-            fk.res = bs.ReadBytes(1);
-            fk.seed = bs.ReadBytes(1);
-            fk.cp.company = (Owner)bs.ReadBytes(1);
-            fk.client_id = bs.ReadBytes(2);
-            fk.cp.cmd = (Commands)bs.ReadBytes(2);
-            fk.cp.data = bs.ReadData();
-            fk.cp.callback = nullptr;
-            _fake_commands.push(fk);
-            error_func(fmt::format("Command {}({}) company={} client={}", GetCommandName(fk.cp.cmd), fk.cp.cmd, fk.cp.company, fk.client_id));
-        }
-    }
-    catch (BitIStreamUnexpectedEnd &) {
-        error_func("Unexpected end of command data");
-    }
+    /* Decode the first batch now, so errors in the log show up when it is loaded. */
+    if (reader->Parse(_fake_commands, FAKE_COMMANDS_QUEUE_SIZE)) _command_log_reader = std::move(reader);
+}
 
-    _replay_started = false;
+void PrintReplayStatistics() {
+    if (!_replay_stats.loaded) return;
+    fmt::print(stderr, "replay executed={} rejected={} mismatched={} desyncs={} remaining={}\n",
+               _replay_stats.executed, _replay_stats.rejected, _replay_stats.mismatched, _replay_stats.desyncs,
+               PeekFakeCommand() != nullptr ? "yes" : "no");
 }
 
 bool IsReplayingCommands() {
-    return !_fake_commands.empty();
+    return PeekFakeCommand() != nullptr;
 }
 
 
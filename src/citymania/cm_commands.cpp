@@ -14,13 +14,10 @@
 
 namespace citymania {
 
-const uint32 MAX_CALLBACK_LIFETIME = 30;  // it should be executed within few frames so 30 more than enough
-
-std::map<size_t, std::pair<uint32, std::vector<CommandCallback>>> _command_callbacks;
-std::queue<std::pair<size_t, uint32>> _command_sent;
 CommandCallback _current_callback = nullptr;
 bool _no_estimate_command = false;
 bool _automatic_command = false;
+uint32_t _commands_executed = 0;
 
 template <typename T, int MaxLen>
 class SumLast {
@@ -62,6 +59,9 @@ struct CallbackQueueEntry {
 };
 
 SumLast<double, 100> _command_lag_tracker;
+// Callbacks of sent commands in sending order. The server executes our commands
+// in the same order so matching in BeforeNetworkCommandExecution only looks at the
+// front; entries in front of a match were rejected by the server and are dropped.
 std::queue<CallbackQueueEntry> _callback_queue;
 
 uint GetCurrentQueueDelay();
@@ -135,50 +135,14 @@ void AddCommandCallback(const CommandPacket *cp) {
     _current_callback = nullptr;
 }
 
-/*
-void AddCommandCallback(TileIndex tile, uint32 p1, uint32 p2, uint32 cmd, const std::string &text, CommandCallback callback) {
-    if (!_networking) {
-        callback(true);
-        return;
-    }
-    auto hash = GetCommandHash(tile, p1, p2, cmd & CMD_ID_MASK, text);
-    auto sent_frame = _frame_counter + GetCurrentQueueDelay();
-    _command_callbacks[hash].first = sent_frame;
-    _command_callbacks[hash].second.push_back(callback);
-    _command_sent.push(std::make_pair(hash, sent_frame));
-    // fprintf(stderr, "CALLBACK %lu (%u %u %u %u %s)\n", hash, tile, p1, p2, (uint)(cmd & CMD_ID_MASK), text.c_str());
-}
-
-*/
-//void HandleCommandExecution(bool res, TileIndex tile, uint32 p1, uint32 p2, uint32 cmd, const std::string &text) {
-    /* FIXME
-    auto hash = GetCommandHash(tile, p1, p2, cmd & CMD_ID_MASK, text);
-    auto p = _command_callbacks.find(hash);
-    // fprintf(stderr, "EXECUTED %lu (%u %u %u %u %s) %u\n", hash, tile, p1, p2, (uint)(cmd & CMD_ID_MASK), text.c_str(), (int)(p == _command_callbacks.end()));
-    if (p == _command_callbacks.end()) return;
-    for (auto &cb : p->second.second)
-        cb(res);
-    _command_callbacks.erase(p); */
-//}
-
-void ClearOldCallbacks() {
-    while(!_command_sent.empty() && _command_sent.front().second + MAX_CALLBACK_LIFETIME < _frame_counter) {
-        auto hash = _command_sent.front().first;
-        _command_sent.pop();
-        auto p = _command_callbacks.find(hash);
-        if (p != _command_callbacks.end() && p->first + MAX_CALLBACK_LIFETIME < _frame_counter) {
-            _command_callbacks.erase(p);
-        }
-    }
-}
-
 std::queue<CommandPacket> _outgoing_queue;
 uint _commands_this_frame;
 
 void InitCommandQueue() {
     _commands_this_frame = 0;
     std::queue<CommandPacket>().swap(_outgoing_queue);  // clear queue
-    _command_callbacks.clear();
+    std::queue<CallbackQueueEntry>().swap(_callback_queue);
+    _current_callback = nullptr;
     _command_lag_tracker.reset();
 }
 
@@ -201,7 +165,6 @@ void FlushCommandQueue() {
 void HandleNextClientFrame() {
     _commands_this_frame = 0;
     FlushCommandQueue();
-    // ClearOldCallbacks();
 }
 
 void SendClientCommand(const CommandPacket *cp) {
@@ -10,6 +10,8 @@ struct CommandPacket;
 
 namespace citymania {
 
+extern uint32_t _commands_executed;  ///< Number of commands executed on the map, used to invalidate cached estimates.
+
 // void HandleCommandExecution(bool res, TileIndex tile, uint32 p1, uint32 p2, uint32 cmd, const std::string &text);
 void AddCommandCallback(const CommandPacket *cp);
 // void ExecuteCurrentCallback(const CommandCost &cost);
@@ -7,10 +7,16 @@
 #include "cm_export.hpp"
 
 #include "../aircraft.h"
+#include "../cargopacket.h"
+#include "../company_base.h"
+#include "../debug.h"
+#include "../station_base.h"
+#include "../timer/timer_game_economy.h"
 #include "../command_func.h"
 #include "../console_func.h"
 #include "../console_type.h"
 #include "../fileio_type.h"
+#include "../fileio_func.h"
 #include "../map_type.h"
 #include "../map_func.h"
 #include "../roadveh.h"
@@ -100,6 +106,25 @@ bool ConExport(std::span<std::string_view> argv) {
     return true;
 }
 
+bool ConExportTiles(std::span<std::string_view> argv) {
+    if (argv.empty() || argv.size() > 2) {
+        IConsoleHelp("Exports the world as 256x256 map tiles for web viewers into <dir>/<z>/<x>/<y>.png. Usage: 'cmexporttiles [dir]'");
+        IConsoleHelp("Default directory is 'tiles' in the screenshot directory. Repeated exports to the same directory only render changed tiles.");
+        return true;
+    }
+
+    std::string dir = argv.size() > 1 ? std::string(argv[1]) : fmt::format("{}tiles", FiosGetScreenshotDir());
+    if (!dir.ends_with(PATHSEPCHAR)) dir += PATHSEPCHAR;
+
+    auto written = citymania::ExportWorldTiles(dir);
+    if (!written.has_value()) {
+        IConsoleError("No screenshot format available");
+        return true;
+    }
+    IConsolePrint(CC_DEFAULT, "Exported {} tiles to {}", *written, dir);
+    return true;
+}
+
 bool ConTreeMap(std::span<std::string_view> argv) {
     if (argv.empty()) {
         IConsoleHelp("Loads heighmap-like file and plants trees according to it, values 0-256 ore scaled to 0-4 trees.");
@@ -263,6 +288,106 @@ bool ConGameStats(std::span<std::string_view> argv) {
     return true;
 }
 
+/** FNV-1a hash of the game state values added to it. */
+class StateHasher {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+public:
+    template <typename T>
+    void Add(T value) {
+        uint64_t v = static_cast<uint64_t>(value);
+        for (int i = 0; i < 8; i++, v >>= 8) {
+            this->hash ^= v & 0xFF;
+            this->hash *= 0x100000001b3ULL;
+        }
+    }
+
+    uint64_t Get() const { return this->hash; }
+};
+
+bool ConStateHash(std::span<std::string_view> argv) {
+    if (argv.empty()) {
+        IConsoleHelp("Prints hashes of the game state per subsystem, to find which one differs between two clients or replays.");
+        IConsoleHelp("Usage: 'cmstatehash'");
+        return true;
+    }
+
+    StateHasher map;
+    for (const auto t : Map::Iterate()) {
+        Tile tile = t;
+        map.Add(tile.type());
+        map.Add(tile.height());
+        map.Add(tile.m1());
+        map.Add(tile.m2());
+        map.Add(tile.m3());
+        map.Add(tile.m4());
+        map.Add(tile.m5());
+        map.Add(tile.m6());
+        map.Add(tile.m7());
+        map.Add(tile.m8());
+    }
+
+    StateHasher vehicles;
+    for (const Vehicle *v : Vehicle::Iterate()) {
+        vehicles.Add(v->index.base());
+        vehicles.Add(v->type);
+        vehicles.Add(v->tile.base());
+        vehicles.Add(v->x_pos);
+        vehicles.Add(v->y_pos);
+        vehicles.Add(v->z_pos);
+        vehicles.Add(v->direction);
+        vehicles.Add(v->cur_speed);
+        vehicles.Add(v->progress);
+        vehicles.Add(v->cargo.StoredCount());
+    }
+
+    StateHasher stations;
+    for (const Station *st : Station::Iterate()) {
+        stations.Add(st->index.base());
+        stations.Add(st->xy.base());
+        stations.Add(st->owner.base());
+        for (const GoodsEntry &ge : st->goods) {
+            stations.Add(ge.rating);
+            stations.Add(ge.time_since_pickup);
+            stations.Add(ge.AvailableCount());
+        }
+    }
+
+    StateHasher companies;
+    for (const Company *c : Company::Iterate()) {
+        companies.Add(c->index.base());
+        companies.Add(c->money.base());
+        companies.Add(c->current_loan.base());
+    }
+
+    StateHasher towns;
+    for (const Town *t : Town::Iterate()) {
+        towns.Add(t->index.base());
+        towns.Add(t->cache.population);
+        towns.Add(t->cache.num_houses);
+        towns.Add(t->grow_counter);
+        towns.Add(t->growth_rate);
+    }
+
+    StateHasher cargo;
+    for (const CargoPacket *cp : CargoPacket::Iterate()) {
+        cargo.Add(cp->index.base());
+        cargo.Add(cp->Count());
+        cargo.Add(cp->GetFirstStation().base());
+        cargo.Add(cp->GetNextHop().base());
+        cargo.Add(cp->GetPeriodsInTransit());
+        cargo.Add(cp->GetFeederShare().base());
+    }
+
+    IConsolePrint(CC_INFO, "State hashes at tick {}:", TimerGameTick::counter);
+    for (auto [name, hasher] : std::initializer_list<std::pair<std::string_view, const StateHasher &>>{
+            {"map", map}, {"vehicles", vehicles}, {"stations", stations}, {"companies", companies}, {"towns", towns}, {"cargo", cargo}}) {
+        IConsolePrint(CC_INFO, "  {}: {:016x}", name, hasher.Get());
+        Debug(desync, 1, "state hash: {:08x}:{:02x} {} {:016x}", TimerGameEconomy::date, TimerGameEconomy::date_fract, name, hasher.Get());
+    }
+
+    return true;
+}
+
 // From jgrpp viewports
 bool ConGfxDebug(std::span<std::string_view> argv) {
     if (argv.empty()) {
@@ -9,10 +9,12 @@ void SkipFakeCommands(TimerGameTick::TickCounter counter);
 void SetReplaySaveInterval(uint32 interval);
 void CheckIntervalSave();
 bool IsReplayingCommands();
+void PrintReplayStatistics();
 
 bool ConGameSpeed(std::span<std::string_view> argv);
 bool ConStep(std::span<std::string_view> argv);
 bool ConExport(std::span<std::string_view> argv);
+bool ConExportTiles(std::span<std::string_view> argv);
 bool ConTreeMap(std::span<std::string_view> argv);
 bool ConResetTownGrowth(std::span<std::string_view> argv);
 bool ConLoadCommands(std::span<std::string_view> argv);
@@ -21,6 +23,7 @@ void ExecuteFakeCommands(TimerGameTick::TickCounter counter);
 bool ConStartRecord(std::span<std::string_view> argv);
 bool ConStopRecord(std::span<std::string_view> argv);
 bool ConGameStats(std::span<std::string_view> argv);
+bool ConStateHash(std::span<std::string_view> argv);
 bool ConGfxDebug(std::span<std::string_view> argv);
 
 } // namespace citymania
@@ -2,14 +2,18 @@
 
 #include "cm_export.hpp"
 
+#include "../blitter/factory.hpp"
 #include "../cargotype.h"
 #include "../debug.h"
+#include "../fileio_func.h"
 #include "../house.h"  // NUM_HOUSES and HZ_* for _town_land.h
+#include "../landscape.h"
 #include "../gfx_func.h"
 #include "../gfx_type.h"
 #include "../engine_base.h"
 #include "../palette_func.h"  // GetColourGradient
 #include "../screenshot.h"
+#include "../screenshot_type.h"
 #include "../spritecache.h"
 #include "../strings_func.h"
 #include "../strings_type.h"
@@ -18,11 +22,14 @@
 #include "../table/strings.h"  // for town_land.h
 #include "../table/train_sprites.h"
 //#include "../table/town_land.h"  // _town_draw_tile_data
+#include "../tile_map.h"
 #include "../timer/timer_game_tick.h"
+#include "../viewport_func.h"
 #include "../viewport_sprite_sorter.h"
 #include "../viewport_type.h"
 #include "../window_func.h"
 #include "../window_gui.h"
+#include "../worker_pool.h"
 #include "../zoom_func.h"
 
 #include <set>
@@ -75,16 +82,23 @@ namespace data_export {
 
 class JsonWriter {
 protected:
+    static const size_t STREAM_BUFFER_SIZE = 1024 * 1024;
+
     int i = 0;
     bool no_comma = true;
     char buffer[128];
     bool js = false;
+    std::unique_ptr<char[]> stream_buffer;
 
 public:
     std::ofstream f;
 
     JsonWriter(const std::string &fname, bool js=false) {
         this->js = js;
+        // Exports can have tens of thousands of entries, so write them in large blocks
+        // and end lines with '\n' rather than std::endl, which flushes every line.
+        this->stream_buffer = std::make_unique<char[]>(STREAM_BUFFER_SIZE);
+        f.rdbuf()->pubsetbuf(this->stream_buffer.get(), STREAM_BUFFER_SIZE);
         f.open(fname.c_str());
         if (this->js) f << "OPENTTD = {";
         no_comma = true;
@@ -92,14 +106,14 @@ public:
 
     ~JsonWriter() {
         this->ident(false);
-        if (this->js) f << "}" << std::endl;
+        if (this->js) f << "}\n";
         f.close();
     }
 
     void ident(bool comma=true) {
         if (comma && !no_comma) f << ",";
         no_comma = false;
-        f << std::endl;
+        f << '\n';
         for(int j = 0; j < i; j++) f << "  ";
     }
 
@@ -275,7 +289,7 @@ void WritePaletteInfo(JsonWriter &j) {
     j.begin_list_with_key("gradients");
     for (auto i = 0; i < COLOUR_END; i++) {
         if (i != 0) j.f << ",";
-        j.f << std::endl << "[";
+        j.f << "\n[";
         for (auto k = 0; k < 8; k++) {
             if (k != 0) j.f << ", ";
             j.f << GetColourGradient((Colours)i, (ColourShade)k).p << " ";
@@ -451,17 +465,32 @@ void ExportFrameSpritesJson() {
     );
 }
 
+// Recorded frames are written to disk on a worker thread so the draw path only
+// has to copy the sprite lists into memory.
+static WorkerPool _recording_writer{"ottd:record"};
+
+static void WriteRecordingFile(std::string fname, std::vector<char> data) {
+    if (!_recording_writer.IsRunning()) _recording_writer.Start(1);
+    _recording_writer.Submit([fname = std::move(fname), data = std::move(data)]() {
+        std::ofstream f(fname, std::ios::binary);
+        f.write(data.data(), data.size());
+    });
+}
+
+static void AppendRecordingData(std::vector<char> &data, const void *src, size_t size) {
+    data.insert(data.end(), static_cast<const char *>(src), static_cast<const char *>(src) + size);
+}
+
 void ExportSprite(SpriteID sprite, SpriteType type) {
     static std::set<SpriteID> exported;
-    if (exported.find(sprite) != exported.end()) return;
-    auto fname = fmt::format("snaps/sprite_{}.bin", sprite);
-    std::ofstream f(fname, std::ios::binary);
+    if (!exported.insert(sprite).second) return;
     uint size;
     void *raw = GetRawSprite(sprite, type);
     if (type == SpriteType::Recolour) size = 257;
     else size = *(((size_t *)raw) - 1);
-    f.write((char *)raw, size);
-    exported.insert(sprite);
+    std::vector<char> data;
+    AppendRecordingData(data, raw, size);
+    WriteRecordingFile(fmt::format("snaps/sprite_{}.bin", sprite), std::move(data));
 }
 
 void ExportSpriteAndPal(SpriteID img, SpriteID pal) {
@@ -486,28 +515,29 @@ void ViewportExport(const Viewport &vp, int left, int top, int right, int bottom
 
     auto fname = fmt::format("snaps/tick_{}.bin", TimerGameTick::counter);
     Debug(misc, 0, "Exporting tick {} into {} box ({},{})-({},{}) ", TimerGameTick::counter, fname, left, top, right, bottom);
-    std::ofstream f(fname, std::ios::binary);
+    std::vector<char> f;
     auto &tile_sprites = ViewportExportGetTileSprites();
     uint64 n = tile_sprites.size();
-    f.write((char *)&n, 8);
-    f.write((const char *)tile_sprites.data(), n * sizeof(TileSpriteToDraw));
+    AppendRecordingData(f, &n, 8);
+    AppendRecordingData(f, tile_sprites.data(), n * sizeof(TileSpriteToDraw));
     for (const auto &ts : tile_sprites) ExportSpriteAndPal(ts.image, ts.pal);
 
     auto &parent_sprites = ViewportExportGetSortedParentSprites();
     n = parent_sprites.size();
-    f.write((char *)&n, 8);
+    AppendRecordingData(f, &n, 8);
     for (const ParentSpriteToDraw *s : ViewportExportGetSortedParentSprites()) {
-        f.write((const char *)s, sizeof(ParentSpriteToDraw) - 4);
+        AppendRecordingData(f, s, sizeof(ParentSpriteToDraw) - 4);
         ExportSpriteAndPal(s->image, s->pal);
     }
 
     auto &child_sprites = ViewportExportGetChildSprites();
     n = child_sprites.size();
-    f.write((char *)&n, 8);
-    f.write((const char *)child_sprites.data(), n * sizeof(ChildScreenSpriteToDraw));
+    AppendRecordingData(f, &n, 8);
+    AppendRecordingData(f, child_sprites.data(), n * sizeof(ChildScreenSpriteToDraw));
     for (const auto &cs : child_sprites) ExportSpriteAndPal(cs.image, cs.pal);
 
     ViewportExportDrawEnd();
+    WriteRecordingFile(std::move(fname), std::move(f));
 }
 
 bool _is_recording = false;
@@ -533,4 +563,106 @@ void StopRecording() {
     _is_recording = false;
 }
 
+// Tiled world export for web map viewers, in the XYZ ("slippy map") layout.
+// After the first export of a game only the tiles covering map tiles that
+// changed since the previous export are rendered again.
+
+static const int WORLD_TILE_SIZE = 256;  ///< Width and height of an exported tile in pixels.
+
+// Maximum extents of the sprites of a map tile around its north corner, the same as used for marking tiles dirty.
+static const int WORLD_TILE_EXTENT_LEFT   = ZOOM_BASE * TILE_PIXELS;
+static const int WORLD_TILE_EXTENT_RIGHT  = ZOOM_BASE * TILE_PIXELS;
+static const int WORLD_TILE_EXTENT_TOP    = ZOOM_BASE * MAX_BUILDING_PIXELS;
+static const int WORLD_TILE_EXTENT_BOTTOM = ZOOM_BASE * (TILE_PIXELS + 2 * TILE_HEIGHT);
+
+static std::vector<bool> _world_tiles_dirty;  ///< Map tiles changed since the last export, empty if nothing was exported in this game.
+static std::string _world_tiles_dir;          ///< Directory of the last export.
+
+void MarkWorldTileDirty(TileIndex tile) {
+    if (tile.base() < _world_tiles_dirty.size()) _world_tiles_dirty[tile.base()] = true;
+}
+
+void ResetWorldTilesExport() {
+    _world_tiles_dirty.clear();
+    _world_tiles_dir.clear();
+}
+
+/**
+ * Export the world as a pyramid of tiles for web map viewers.
+ * Tiles are written as <dir>/<z>/<x>/<y>.<ext>, one zoom level per world screenshot
+ * zoom level, with z = 0 the most zoomed out one.
+ * @param dir Directory to export to, ending with a path separator.
+ * @return Number of tiles written, or std::nullopt if there is no screenshot provider.
+ */
+std::optional<size_t> ExportWorldTiles(const std::string &dir) {
+    auto provider = GetScreenshotProvider();
+    if (provider == nullptr) return std::nullopt;
+
+    bool full = _world_tiles_dirty.size() != Map::Size() || _world_tiles_dir != dir;
+    std::vector<Rect> changed;
+    if (!full) {
+        for (uint i = 0; i < Map::Size(); i++) {
+            if (!_world_tiles_dirty[i]) continue;
+            TileIndex t{i};
+            Point pt = RemapCoords(TileX(t) * TILE_SIZE, TileY(t) * TILE_SIZE, TileHeight(t) * TILE_HEIGHT);
+            changed.push_back({pt.x - WORLD_TILE_EXTENT_LEFT, pt.y - WORLD_TILE_EXTENT_TOP, pt.x + WORLD_TILE_EXTENT_RIGHT, pt.y + WORLD_TILE_EXTENT_BOTTOM});
+        }
+    }
+
+    const Viewport world = SetupScreenshotViewport(SC_WORLD);
+    const int depth = BlitterFactory::GetCurrentBlitter()->GetScreenDepth();
+    size_t written = 0;
+
+    for (ZoomLevel zoom = ZoomLevel::WorldScreenshot; zoom <= ZoomLevel::Max; zoom++) {
+        const int z = to_underlying(ZoomLevel::Max) - to_underlying(zoom);
+        const int size = ScaleByZoom(WORLD_TILE_SIZE, zoom);  // Tile size in world coordinates.
+        const int columns = CeilDiv(world.virtual_width, size);
+        const int rows = CeilDiv(world.virtual_height, size);
+
+        std::vector<bool> render(static_cast<size_t>(columns) * rows, full);
+        for (const Rect &r : changed) {
+            int x1 = std::max((r.left - world.virtual_left) / size, 0);
+            int y1 = std::max((r.top - world.virtual_top) / size, 0);
+            int x2 = std::min((r.right - world.virtual_left) / size, columns - 1);
+            int y2 = std::min((r.bottom - world.virtual_top) / size, rows - 1);
+            for (int y = y1; y <= y2; y++) {
+                for (int x = x1; x <= x2; x++) render[static_cast<size_t>(y) * columns + x] = true;
+            }
+        }
+
+        for (int x = 0; x < columns; x++) {
+            bool dir_created = false;
+            for (int y = 0; y < rows; y++) {
+                if (!render[static_cast<size_t>(y) * columns + x]) continue;
+
+                std::string column_dir = fmt::format("{}{}{}{}{}", dir, z, PATHSEP, x, PATHSEP);
+                if (!dir_created) {
+                    FioCreateDirectory(column_dir);
+                    dir_created = true;
+                }
+
+                Viewport vp = world;
+                vp.zoom = zoom;
+                vp.virtual_left = world.virtual_left + x * size;
+                vp.virtual_top = world.virtual_top + y * size;
+                vp.virtual_width = vp.virtual_height = size;
+                vp.width = vp.height = WORLD_TILE_SIZE;
+                UpdateViewportSizeZoom(vp);
+
+                auto fname = fmt::format("{}{}.{}", column_dir, y, provider->GetName());
+                if (!provider->MakeImage(fname, [&vp](void *buf, uint y, uint pitch, uint n) { LargeWorldCallback(vp, buf, y, pitch, n); },
+                        WORLD_TILE_SIZE, WORLD_TILE_SIZE, depth, _cur_palette.palette)) {
+                    Debug(misc, 0, "Failed to write world tile {}", fname);
+                    continue;
+                }
+                written++;
+            }
+        }
+    }
+
+    _world_tiles_dirty.assign(Map::Size(), false);
+    _world_tiles_dir = dir;
+    return written;
+}
+
 } // namespace citymania
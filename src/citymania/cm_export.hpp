@@ -1,6 +1,9 @@
 #ifndef CM_EXPORT_HPP
 #define CM_EXPORT_HPP
 
+#include "../tile_type.h"
+
+#include <optional>
 #include <string>
 
 namespace citymania {
@@ -9,6 +12,9 @@ void ExportOpenttdData(const std::string &filename);
 void ExportFrameSprites();
 void StartRecording();
 void StopRecording();
+std::optional<size_t> ExportWorldTiles(const std::string &dir);
+void MarkWorldTileDirty(TileIndex tile);
+void ResetWorldTilesExport();
 
 } // namespace citymania
 
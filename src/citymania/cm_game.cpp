@@ -9,6 +9,47 @@
 
 namespace citymania {
 
+/** Clear all states and resize the index to the current map. */
+void TownGrowthTilesMap::Reset() {
+    this->tiles.assign(Map::Size(), 0);
+    this->touched[0].clear();
+    this->touched[1].clear();
+    this->current = 0;
+}
+
+void TownGrowthTilesMap::SetSlot(TileIndex tile, uint8_t slot, TownGrowthTileState state) {
+    if (this->tiles.size() != Map::Size()) this->Reset();
+    uint8_t &v = this->tiles[tile.base()];
+    uint8_t shift = this->Shift(slot);
+    uint8_t old = (v >> shift) & 0xF;
+    if (old >= to_underlying(state)) return;
+    if (old == 0) this->touched[slot].push_back(tile);
+    v = (v & ~(0xF << shift)) | (to_underlying(state) << shift);
+}
+
+/** Raise the current month state of the tile to \a state. */
+void TownGrowthTilesMap::Set(TileIndex tile, TownGrowthTileState state) {
+    this->SetSlot(tile, this->current, state);
+}
+
+/** Raise the last month state of the tile to \a state. */
+void TownGrowthTilesMap::SetLastMonth(TileIndex tile, TownGrowthTileState state) {
+    this->SetSlot(tile, this->current ^ 1, state);
+}
+
+/**
+ * Make the current month the last one. Only the tiles that had a state two
+ * months ago are cleared so the cost is proportional to the number of events.
+ */
+void TownGrowthTilesMap::NewMonth() {
+    this->current ^= 1;
+    uint8_t mask = ~(0xF << this->Shift(this->current));
+    for (TileIndex tile : this->touched[this->current]) {
+        if (tile.base() < this->tiles.size()) this->tiles[tile.base()] &= mask;
+    }
+    this->touched[this->current].clear();
+}
+
 Game::Game() {
     this->events.listen<event::NewMonth>(event::Slot::GAME, [this] (const event::NewMonth &) {
         for (Town *t : Town::Iterate()) {
@@ -28,8 +69,7 @@ Game::Game() {
             t->cm.growth_tiles.clear();
         }
 
-        this->towns_growth_tiles_last_month.swap(this->towns_growth_tiles);
-        this->towns_growth_tiles.clear();
+        this->towns_growth_tiles.NewMonth();
     });
 
     this->events.listen<event::TownBuilt>(event::Slot::GAME, [] (const event::TownBuilt &event) {
@@ -88,16 +128,15 @@ Game::Game() {
     });
 
     this->events.listen<event::TownCachesRebuilt>(event::Slot::GAME, [this] (const event::TownCachesRebuilt&) {
-        this->towns_growth_tiles.clear();
-        this->towns_growth_tiles_last_month.clear();
+        this->towns_growth_tiles.Reset();
         for (Town *town : Town::Iterate()) {
             town->cm.real_population = 0;
             town->cm.houses_constructing = 0;
             for (auto &[tile, state] : town->cm.growth_tiles) {
-                if (this->towns_growth_tiles[tile] < state) this->towns_growth_tiles[tile] = state;
+                this->towns_growth_tiles.Set(tile, state);
             }
             for (auto &[tile, state] : town->cm.growth_tiles_last_month) {
-                if (this->towns_growth_tiles_last_month[tile] < state) this->towns_growth_tiles_last_month[tile] = state;
+                this->towns_growth_tiles.SetLastMonth(tile, state);
             }
         }
         for (auto t : Map::Iterate()) {
@@ -116,7 +155,7 @@ Game::Game() {
 }
 
 void Game::set_town_growth_tile(Town *town, TileIndex tile, TownGrowthTileState state) {
-    if (this->towns_growth_tiles[tile] < state) this->towns_growth_tiles[tile] = state;
+    this->towns_growth_tiles.Set(tile, state);
     if (town->cm.growth_tiles[tile] < state) town->cm.growth_tiles[tile] = state;
 }
 
@@ -5,12 +5,44 @@
 
 #include "cm_event.hpp"
 
+#include <vector>
+
 namespace citymania {
 
+/**
+ * Map-sized index of town growth tile states for this and the last month.
+ * Each tile uses one byte with a 4-bit state per month, the nibble that holds
+ * the current month alternates so that the monthly rotation never has to
+ * touch the whole map.
+ */
+class TownGrowthTilesMap {
+protected:
+    std::vector<uint8_t> tiles;      ///< Two 4-bit states per tile.
+    std::vector<TileIndex> touched[2];  ///< Tiles that have a non-empty state in the corresponding nibble.
+    uint8_t current = 0;             ///< Nibble (0 - low, 1 - high) that holds the current month.
+
+    inline uint8_t Shift(uint8_t slot) const { return slot * 4; }
+
+public:
+    void Reset();
+    void Set(TileIndex tile, TownGrowthTileState state);
+    void SetLastMonth(TileIndex tile, TownGrowthTileState state);
+    void NewMonth();
+
+    /** Get the highest state of the tile in this and the last month. */
+    inline TownGrowthTileState Get(TileIndex tile) const {
+        if (tile.base() >= this->tiles.size()) return TownGrowthTileState::NONE;
+        uint8_t v = this->tiles[tile.base()];
+        return static_cast<TownGrowthTileState>(std::max<uint8_t>(v & 0xF, v >> 4));
+    }
+
+private:
+    void SetSlot(TileIndex tile, uint8_t slot, TownGrowthTileState state);
+};
+
 class Game {
 protected:
-    TownsGrowthTilesIndex towns_growth_tiles_last_month;
-    TownsGrowthTilesIndex towns_growth_tiles;
+    TownGrowthTilesMap towns_growth_tiles;
     uint64 start_countdown = 0;
 
 public:
@@ -20,11 +52,7 @@ public:
     void set_town_growth_tile(Town *town, TileIndex tile, TownGrowthTileState state);
     
     TownGrowthTileState get_town_growth_tile(TileIndex tile) {
-        auto a = this->towns_growth_tiles.find(tile);
-        auto b = this->towns_growth_tiles_last_month.find(tile);
-        auto as = (a == this->towns_growth_tiles.end() ? TownGrowthTileState::NONE : (*a).second);
-        auto bs = (b == this->towns_growth_tiles_last_month.end() ? TownGrowthTileState::NONE : (*b).second);
-        return std::max(as, bs);
+        return this->towns_growth_tiles.Get(tile);
     }
 };
 
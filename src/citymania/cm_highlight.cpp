@@ -203,6 +203,12 @@ struct TileZoning {
 };
 
 static std::unique_ptr<TileZoning[]> _mz = nullptr;
+static std::vector<ZoningBorder> _station_catchment_borders;
+static bool _station_catchment_borders_valid = false;
+static std::vector<TileArea> _station_catchment_borders_dirty_areas;
+static std::vector<StationID> _station_catchment_borders_dirty_stations;
+static std::vector<std::pair<TileIndex, ZoningBorder>> _selected_station_catchment_border;
+static StationID _selected_station_catchment_border_id = StationID::Invalid();
 static IndustryType _industry_forbidden_tiles = IT_INVALID;
 
 extern bool _fn_mod;
@@ -450,6 +456,14 @@ bool ObjectHighlight::operator==(const ObjectHighlight& oh) const {
             && this->ddir == oh.ddir
             && this->roadtype == oh.roadtype
             && this->is_truck == oh.is_truck
+            && this->w == oh.w
+            && this->h == oh.h
+            && this->road_stop_spec_class == oh.road_stop_spec_class
+            && this->road_stop_spec_index == oh.road_stop_spec_index
+            && this->rail_station_class == oh.rail_station_class
+            && this->rail_station_type == oh.rail_station_type
+            && this->ind_type == oh.ind_type
+            && this->ind_layout == oh.ind_layout
             && this->airport_type == oh.airport_type
             && this->airport_layout == oh.airport_layout
             && this->blueprint == oh.blueprint);
@@ -580,7 +594,7 @@ void ObjectHighlight::AddTile(TileIndex tile, ObjectTileHighlight &&oh) {
         if (y == 0 || y >= Map::SizeY() - 1) return;
     }
 
-    this->tiles.insert(std::make_pair(tile, std::move(oh)));
+    this->tiles.Add(tile, std::move(oh));
 }
 
 uint16_t GetPreviewStationCallback(CallbackID callback, uint32_t param1, uint32_t param2, const StationSpec *statspec, TileIndex tile, TileArea area, StationGfx gfx, Axis axis);
@@ -629,7 +643,7 @@ std::vector<uint8_t> &GetPreviewStationLayout(const StationSpec *statspec, Axis
 }
 
 void ObjectHighlight::UpdateTiles() {
-    this->tiles.clear();
+    this->tiles.Clear();
     this->sprites.clear();
     this->cost = CMD_ERROR;
     switch (this->type) {
@@ -646,7 +660,7 @@ void ObjectHighlight::UpdateTiles() {
             ).test();
             auto palette = (cost.Succeeded() ? CM_PALETTE_TINT_WHITE : CM_PALETTE_TINT_RED_DEEP);
 
-            this->tiles.insert(std::make_pair(this->tile, ObjectTileHighlight::make_rail_depot(palette, dir)));
+            this->tiles.Add(this->tile, ObjectTileHighlight::make_rail_depot(palette, dir));
             auto tile = AddTileIndexDiffCWrap(this->tile, TileIndexDiffCByDiagDir(dir));
             if (tile == INVALID_TILE) break;
             if (IsTileType(tile, MP_RAILWAY) && IsCompatibleRail(GetRailType(tile), _cur_railtype)) {
@@ -753,7 +767,7 @@ void ObjectHighlight::UpdateTiles() {
         }
         case Type::BLUEPRINT:
             if (this->blueprint && this->tile != INVALID_TILE)
-                this->tiles = this->blueprint->GetTiles(this->tile);
+                this->blueprint->GetTiles(this->tile, this->tiles);
             break;
         case Type::POLYRAIL: {
 
@@ -878,20 +892,24 @@ void ObjectHighlight::UpdateTiles() {
     }
 }
 
+static void MarkDetachedHighlightDirty(const DetachedHighlight &s) {
+    auto sprite = GetSprite(GB(s.sprite_id, 0, SPRITE_WIDTH), SpriteType::Normal);
+    auto left = s.pt.x + sprite->x_offs;
+    auto top = s.pt.y + sprite->y_offs;
+    MarkAllViewportsDirty(
+        left,
+        top,
+        left + UnScaleByZoom(sprite->width, ZoomLevel::Normal),
+        top + UnScaleByZoom(sprite->height, ZoomLevel::Normal)
+    );
+}
+
 void ObjectHighlight::MarkDirty() {
     for (const auto &kv: this->tiles) {
         MarkTileDirtyByTile(kv.first);
     }
     for (const auto &s: this->sprites) {
-        auto sprite = GetSprite(GB(s.sprite_id, 0, SPRITE_WIDTH), SpriteType::Normal);
-        auto left = s.pt.x + sprite->x_offs;
-        auto top = s.pt.y + sprite->y_offs;
-        MarkAllViewportsDirty(
-            left,
-            top,
-            left + UnScaleByZoom(sprite->width, ZoomLevel::Normal),
-            top + UnScaleByZoom(sprite->height, ZoomLevel::Normal)
-        );
+        MarkDetachedHighlightDirty(s);
     }
     if (this->type == ObjectHighlight::Type::BLUEPRINT && this->blueprint) {  // TODO why && blueprint check is needed?
         for (auto tile : this->blueprint->source_tiles) {
@@ -902,6 +920,30 @@ void ObjectHighlight::MarkDirty() {
     // fprintf(stderr, "E\n");
 }
 
+/**
+ * Marks dirty only the parts of this highlight that are not drawn the same way by the other one.
+ * Polyrail sprites are laid out from the start tile, so when only the end tile moves both
+ * highlights share a prefix of sprites that does not need to be redrawn. All polyrail tiles
+ * are plain points, so a tile present in both highlights looks the same in both.
+ * @param other Highlight this one is being replaced with or replaces.
+ */
+void ObjectHighlight::MarkChangedPolyrailDirty(const ObjectHighlight &other) {
+    assert(this->type == Type::POLYRAIL && other.type == Type::POLYRAIL);
+    for (const auto &kv: this->tiles) {
+        if (!other.tiles.Contains(kv.first)) MarkTileDirtyByTile(kv.first);
+    }
+    size_t common = 0;
+    while (common < this->sprites.size() && common < other.sprites.size()) {
+        auto &a = this->sprites[common];
+        auto &b = other.sprites[common];
+        if (a.pt.x != b.pt.x || a.pt.y != b.pt.y || a.sprite_id != b.sprite_id || a.palette_id != b.palette_id) break;
+        common++;
+    }
+    for (size_t i = common; i < this->sprites.size(); i++) {
+        MarkDetachedHighlightDirty(this->sprites[i]);
+    }
+}
+
 
 template <typename F>
 uint8 Get(uint32 x, uint32 y, F getter) {
@@ -931,43 +973,89 @@ std::pair<ZoningBorder, uint8> CalcTileBorders(TileIndex tile, F getter) {
     return std::make_pair(res, z);
 }
 
-const HighlightMap::MapType &HighlightMap::GetMap() const {
-    return this->map;
+void HighlightMap::Sort() const {
+    if (this->sorted) return;
+    std::stable_sort(this->items.begin(), this->items.end(), [](const Item &a, const Item &b) { return a.first < b.first; });
+    this->sorted = true;
+}
+
+void HighlightMap::Clear() {
+    this->items.clear();
+    this->sorted = true;
+}
+
+std::vector<HighlightMap::Item>::const_iterator HighlightMap::begin() const {
+    this->Sort();
+    return this->items.cbegin();
+}
+
+std::vector<HighlightMap::Item>::const_iterator HighlightMap::end() const {
+    return this->items.cend();
 }
 
 void HighlightMap::Add(TileIndex tile, ObjectTileHighlight oth) {
-    this->map[tile].push_back(oth);
+    if (!this->items.empty() && this->items.back().first > tile) this->sorted = false;
+    this->items.emplace_back(tile, oth);
 }
 
 bool HighlightMap::Contains(TileIndex tile) const {
-    return this->map.find(tile) != this->map.end();
+    return !this->GetForTile(tile).empty();
 }
 
-std::optional<std::reference_wrapper<const std::vector<ObjectTileHighlight>>>
-        HighlightMap::GetForTile(TileIndex tile) const {
-    auto it = this->map.find(tile);
-    if (it == this->map.end()) return std::nullopt;
-    return it->second;
+std::span<const HighlightMap::Item> HighlightMap::GetForTile(TileIndex tile) const {
+    this->Sort();
+    auto first = std::partition_point(this->items.begin(), this->items.end(), [tile](const Item &a) { return a.first < tile; });
+    auto last = std::partition_point(first, this->items.end(), [tile](const Item &a) { return a.first == tile; });
+    return {first, last};
 }
 
-HighlightMap::MapTypeKeys HighlightMap::GetAllTiles() const {
-    return std::views::keys(this->map);
+std::vector<TileIndex> HighlightMap::GetAllTiles() const {
+    this->Sort();
+    std::vector<TileIndex> res;
+    for (auto &[tile, _] : this->items) {
+        if (res.empty() || res.back() != tile) res.push_back(tile);
+    }
+    return res;
 }
 
-std::vector<TileIndex> HighlightMap::UpdateWithMap(const HighlightMap &update) {
-    std::vector<TileIndex> tiles_changed;
-    for (auto it = this->map.begin(); it != this->map.end();) {
-        tiles_changed.push_back(it->first);
-        it = (update.Contains(it->first) ? std::next(it) : this->map.erase(it));
-    }
-    for (auto &[t, l] : update.GetMap()) {
-        auto it = this->map.find(t);
-        if (it != this->map.end() && it->second == l)
-            continue;
-        this->map.insert_or_assign(it, t, l);
-        tiles_changed.push_back(t);
+/**
+ * Replace the contents with the contents of another map.
+ * @param update New highlight map.
+ * @return Runs of tiles along the X axis which highlighting has changed.
+ */
+std::vector<TileArea> HighlightMap::UpdateWithMap(const HighlightMap &update) {
+    this->Sort();
+    update.Sort();
+
+    std::vector<TileArea> res;
+    auto add_changed = [&res](TileIndex tile) {
+        if (!res.empty()) {
+            auto &last = res.back();
+            if (TileY(last.tile) == TileY(tile) && TileX(last.tile) + last.w == TileX(tile)) {
+                last.w++;
+                return;
+            }
+        }
+        res.emplace_back(tile, 1, 1);
+    };
+
+    /* Both vectors are sorted by tile so walk them together comparing highlights of each tile. */
+    auto a = this->items.begin(), ae = this->items.end();
+    auto b = update.items.begin(), be = update.items.end();
+    while (a != ae || b != be) {
+        TileIndex tile = (b == be || (a != ae && a->first < b->first)) ? a->first : b->first;
+        auto a_end = a, b_end = b;
+        while (a_end != ae && a_end->first == tile) a_end++;
+        while (b_end != be && b_end->first == tile) b_end++;
+        if (!std::equal(a, a_end, b, b_end, [](const Item &x, const Item &y) { return x.second == y.second; })) {
+            add_changed(tile);
+        }
+        a = a_end;
+        b = b_end;
     }
-    return tiles_changed;
+
+    this->items = update.items;
+    return res;
 }
 
 void HighlightMap::AddTileArea(const TileArea &area, SpriteID palette) {
@@ -1023,6 +1111,17 @@ void HighlightMap::AddTilesBorder(const std::set<TileIndex> &tiles, SpriteID pal
     }
 }
 
+// Adds borders for the tiles of the area that are in the set defined by in_set, borders
+// towards tiles outside the area are calculated the same way.
+void HighlightMap::AddTilesBorder(const TileArea &area, const std::function<bool(TileIndex)> &in_set, SpriteID palette) {
+    for (auto t : area) {
+        if (!in_set(t)) continue;
+        auto b = CalcTileBorders(t, [&in_set](TileIndex t) { return in_set(t) ? 1 : 0; });
+        if (b.first != ZoningBorder::NONE)
+            this->Add(t, ObjectTileHighlight::make_border(palette, b.first));
+    }
+}
+
 SpriteID MixTints(SpriteID bottom, SpriteID top) {
     if (top == PAL_NONE) return bottom;
     if (bottom == PAL_NONE) return top;
@@ -1920,15 +2019,13 @@ void DrawBorderSprites(const TileInfo *ti, ZoningBorder border, SpriteID color)
 
 TileHighlight ObjectHighlight::GetTileHighlight(const TileInfo *ti) {
     TileHighlight th;
-    auto range = this->tiles.equal_range(ti->tile);
-    for (auto t = range.first; t != range.second; t++) {
-        t->second.SetTileHighlight(th, ti);
+    for (auto &[_, oth] : this->tiles.GetForTile(ti->tile)) {
+        oth.SetTileHighlight(th, ti);
     }
     return th;
 }
 
 void ObjectHighlight::AddToHighlightMap(HighlightMap &hlmap, SpriteID palette) {
-    // TODO remove the need to convert (maybe replace HighlightMap with multimap?)
     for (auto &[tile, oth] : this->tiles) {
         auto othp = oth;
         othp.palette = palette;
@@ -2046,9 +2143,8 @@ static void DrawObjectTileHighlight(const TileInfo *ti, const ObjectTileHighligh
 }
 
 void ObjectHighlight::Draw(const TileInfo *ti) {
-    auto range = this->tiles.equal_range(ti->tile);
-    for (auto t = range.first; t != range.second; t++) {
-        DrawObjectTileHighlight(ti, t->second);
+    for (auto &[_, oth] : this->tiles.GetForTile(ti->tile)) {
+        DrawObjectTileHighlight(ti, oth);
     }
     // fprintf(stderr, "TILEH DRAW %d %d %d\n", ti->tile, (int)i, (int)this->tiles.size());
 }
@@ -2355,11 +2451,8 @@ TileHighlight GetTileHighlight(const TileInfo *ti, TileType tile_type) {
     SetStationSelectionHighlight(ti, th);
     SetBlueprintHighlight(ti, th);
 
-    auto hl = _at.tiles.GetForTile(ti->tile);
-    if (hl.has_value()) {
-        for (auto &oth : hl->get()) {
-            oth.SetTileHighlight(th, ti);
-        }
+    for (auto &[_, oth] : _at.tiles.GetForTile(ti->tile)) {
+        oth.SetTileHighlight(th, ti);
     }
     return th;
 }
@@ -2382,8 +2475,8 @@ bool DrawTileSelection(const TileInfo *ti, [[maybe_unused]] const TileHighlightT
     if (ti->tile == INVALID_TILE || IsTileType(ti->tile, MP_VOID)) return false;
 
     auto hl = _at.tiles.GetForTile(ti->tile);
-    if (hl.has_value()) {
-        for (auto &oth : hl.value().get()) {
+    if (!hl.empty()) {
+        for (auto &[_, oth] : hl) {
             DrawObjectTileHighlight(ti, oth);
         }
         return true;
@@ -2539,7 +2632,15 @@ HighLightStyle UpdateTileSelection(HighLightStyle new_drawstyle) {
                                                      TileVirtXY(_thd.selend2.x, _thd.selend2.y),
                                                      _thd.cm_poly_dir2);
     }
-    if (force_new || _thd.cm != _thd.cm_new) {
+    if (!force_new && _thd.cm != _thd.cm_new && _thd.cm.type == ObjectHighlight::Type::POLYRAIL
+            && _thd.cm_new.type == ObjectHighlight::Type::POLYRAIL) {
+        /* Long polyrail drags only change the tail of the path, redraw just that. */
+        auto old = std::move(_thd.cm);
+        _thd.cm = _thd.cm_new;
+        _thd.cm.UpdateTiles();
+        old.MarkChangedPolyrailDirty(_thd.cm);
+        _thd.cm.MarkChangedPolyrailDirty(old);
+    } else if (force_new || _thd.cm != _thd.cm_new) {
         _thd.cm.MarkDirty();
         _thd.cm = _thd.cm_new;
         _thd.cm.UpdateTiles();
@@ -2550,6 +2651,12 @@ HighLightStyle UpdateTileSelection(HighLightStyle new_drawstyle) {
 
 void AllocateZoningMap(uint map_size) {
     _mz = std::make_unique<TileZoning[]>(map_size);
+    _station_catchment_borders.clear();
+    _station_catchment_borders_valid = false;
+    _station_catchment_borders_dirty_areas.clear();
+    _station_catchment_borders_dirty_stations.clear();
+    _selected_station_catchment_border.clear();
+    _selected_station_catchment_border_id = StationID::Invalid();
 }
 
 uint8 GetTownZone(Town *town, TileIndex tile) {
@@ -2658,13 +2765,84 @@ std::pair<ZoningBorder, uint8> GetTownZoneBorder(TileIndex tile) {
     return CalcTileBorders(tile, [](TileIndex t) { return _mz[t.base()].town_zone; });
 }
 
+// Called before the catchment of the station changes or the station is removed.
+// A station only adds borders to the tiles of its own catchment, so only its old
+// and new catchment areas need to be redone. Too many changes at once, like
+// recomputing all catchments, rebuild the whole map instead.
+void InvalidateStationCatchmentBorders(const Station *st) {
+    static const size_t MAX_DIRTY_STATIONS = 64;
+
+    if (_selected_station_catchment_border_id == st->index) _selected_station_catchment_border_id = StationID::Invalid();
+    if (!_station_catchment_borders_valid) return;
+
+    if (_station_catchment_borders_dirty_stations.size() >= MAX_DIRTY_STATIONS) {
+        _station_catchment_borders_valid = false;
+        _station_catchment_borders_dirty_areas.clear();
+        _station_catchment_borders_dirty_stations.clear();
+        return;
+    }
+
+    if (st->catchment_tiles.w != 0) _station_catchment_borders_dirty_areas.push_back(st->catchment_tiles);
+    _station_catchment_borders_dirty_stations.push_back(st->index);
+}
+
+static ZoningBorder CalcStationCatchmentBorder(const Station *st, TileIndex tile) {
+    return CalcTileBorders(tile, [st](TileIndex t) { return st->TileIsInCatchment(t) ? 1 : 0; }).first;
+}
+
+// Borders of all station catchments, built lazily for the whole map when
+// station catchment zoning is drawn and then updated for the changed stations.
+static void UpdateStationCatchmentBorders() {
+    if (!_station_catchment_borders_valid) {
+        _station_catchment_borders.assign(Map::Size(), ZoningBorder::NONE);
+        for (const Station *st : Station::Iterate()) {
+            BitmapTileIterator it(st->catchment_tiles);
+            for (TileIndex tile = it; tile != INVALID_TILE; tile = ++it) {
+                _station_catchment_borders[tile.base()] |= CalcStationCatchmentBorder(st, tile);
+            }
+        }
+        _station_catchment_borders_valid = true;
+        return;
+    }
+
+    if (_station_catchment_borders_dirty_stations.empty()) return;
+
+    for (StationID id : _station_catchment_borders_dirty_stations) {
+        const Station *st = Station::GetIfValid(id);
+        if (st != nullptr && st->catchment_tiles.w != 0) _station_catchment_borders_dirty_areas.push_back(st->catchment_tiles);
+    }
+    _station_catchment_borders_dirty_stations.clear();
+
+    for (const TileArea &area : _station_catchment_borders_dirty_areas) {
+        for (TileIndex tile : area) _station_catchment_borders[tile.base()] = ZoningBorder::NONE;
+        for (const Station *st : Station::Iterate()) {
+            if (!st->catchment_tiles.Intersects(area)) continue;
+            for (TileIndex tile : area) {
+                if (st->TileIsInCatchment(tile)) _station_catchment_borders[tile.base()] |= CalcStationCatchmentBorder(st, tile);
+            }
+        }
+    }
+    _station_catchment_borders_dirty_areas.clear();
+}
+
 ZoningBorder GetAnyStationCatchmentBorder(TileIndex tile) {
-    ZoningBorder border = ZoningBorder::NONE;
-    StationFinder morestations(TileArea(tile, 1, 1));
-    for (Station *st: morestations.GetStations()) {
-        border |= CalcTileBorders(tile, [st](TileIndex t) {return st->TileIsInCatchment(t) ? 1 : 0; }).first;
+    UpdateStationCatchmentBorders();
+    return _station_catchment_borders[tile.base()];
+}
+
+// Border tiles of a single station catchment, used for the coverage highlight of
+// the selected station. Only the last requested station is kept and it is discarded
+// when the catchment of that station changes or the station is removed.
+const std::vector<std::pair<TileIndex, ZoningBorder>> &GetStationCatchmentBorder(const Station *st) {
+    if (_selected_station_catchment_border_id == st->index) return _selected_station_catchment_border;
+    _selected_station_catchment_border.clear();
+    BitmapTileIterator it(st->catchment_tiles);
+    for (TileIndex tile = it; tile != INVALID_TILE; tile = ++it) {
+        auto b = CalcStationCatchmentBorder(st, tile);
+        if (b != ZoningBorder::NONE) _selected_station_catchment_border.emplace_back(tile, b);
     }
-    return border;
+    _selected_station_catchment_border_id = st->index;
+    return _selected_station_catchment_border;
 }
 
 void SetIndustryForbiddenTilesHighlight(IndustryType type) {
@@ -2749,8 +2927,8 @@ void SetActiveTool(up<Tool> &&tool) {
 }
 
 void ResetActiveTool() {
-    for (auto t : _at.tiles.GetAllTiles()) {
-        MarkTileDirtyByTile(t);
+    for (auto &ta : _at.tiles.UpdateWithMap({})) {
+        MarkTileAreaDirty(ta);
     }
     _at.tool = nullptr;
     _at.tiles = {};
@@ -2773,9 +2951,8 @@ void UpdateActiveTool() {
         info = _at.tool->GetGUIInfo();
     }
     auto [hlmap, overlay_data, cost] = info;
-    auto tiles_changed = _at.tiles.UpdateWithMap(hlmap);
-    for (auto t : tiles_changed)
-        MarkTileDirtyByTile(t);
+    for (auto &ta : _at.tiles.UpdateWithMap(hlmap))
+        MarkTileAreaDirty(ta);
 
     if (cost.GetExpensesType() != INVALID_EXPENSES || cost.GetErrorMessage() != INVALID_STRING_ID) {
         // Add CommandCost info
@@ -7,6 +7,7 @@
 #include "../core/enum_type.hpp"
 #include "../gfx_type.h"
 #include "../industry_type.h"
+#include "../station_type.h"
 #include "../tile_cmd.h"
 #include "../tile_type.h"
 #include "../tilehighlight_type.h"
@@ -45,6 +46,8 @@ HighLightStyle UpdateTileSelection(HighLightStyle new_drawstyle);
 
 std::pair<ZoningBorder, uint8> GetTownZoneBorder(TileIndex tile);
 ZoningBorder GetAnyStationCatchmentBorder(TileIndex tlie);
+void InvalidateStationCatchmentBorders(const Station *st);
+const std::vector<std::pair<TileIndex, ZoningBorder>> &GetStationCatchmentBorder(const Station *st);
 // std::pair<ZoningBorder, uint8> GetTownAdvertisementBorder(TileIndex tile);
 //
 SpriteID GetTownTileZoningPalette(TileIndex tile);
@@ -11,13 +11,15 @@
 #include "../station_type.h"
 #include "../station_gui.h"  // StationCoverageType
 #include "../tile_cmd.h"
+#include "../tilearea_type.h"
 #include "../tile_type.h"
 #include "../track_type.h"
 
+#include <functional>
 #include <map>
 #include <optional>
 #include <set>
-#include <ranges>
+#include <span>
 #include <type_traits>
 #include <unordered_set>
 #include <vector>
@@ -257,6 +259,35 @@ public:
     }
 };
 
+/**
+ * Set of tile highlights stored as a flat vector sorted by tile.
+ * Highlights of the same tile keep the order they were added in.
+ * Clearing keeps the allocated memory so maps that are rebuilt on every
+ * cursor move don't allocate after the first few updates.
+ */
+class HighlightMap {
+public:
+    typedef std::pair<TileIndex, ObjectTileHighlight> Item;
+protected:
+    mutable std::vector<Item> items;
+    mutable bool sorted = true;
+    void Sort() const;
+public:
+    void Clear();
+    std::vector<Item>::const_iterator begin() const;
+    std::vector<Item>::const_iterator end() const;
+    void Add(TileIndex tile, ObjectTileHighlight oth);
+    bool Contains(TileIndex tile) const;
+    std::span<const Item> GetForTile(TileIndex tile) const;
+    std::vector<TileIndex> GetAllTiles() const;
+    std::vector<TileArea> UpdateWithMap(const HighlightMap &update);
+    void AddTileArea(const TileArea &area, SpriteID palette);
+    void AddTileAreaWithBorder(const TileArea &area, SpriteID palette);
+    void AddTilesBorder(const std::set<TileIndex> &tiles, SpriteID palette);
+    void AddTilesBorder(const TileArea &area, const std::function<bool(TileIndex)> &in_set, SpriteID palette);
+};
+
+
 class Blueprint {
 public:
     class Item {
@@ -343,26 +374,7 @@ public:
 
     sp<Blueprint> Rotate();
 
-    std::multimap<TileIndex, ObjectTileHighlight> GetTiles(TileIndex tile);
-};
-
-
-class HighlightMap {
-public:
-    typedef std::map<TileIndex, std::vector<ObjectTileHighlight>> MapType;
-    typedef decltype(std::views::keys(std::declval<const MapType &>())) MapTypeKeys;
-protected:
-    MapType map;
-public:
-    const MapType &GetMap() const;
-    void Add(TileIndex tile, ObjectTileHighlight oth);
-    bool Contains(TileIndex tile) const;
-    std::optional<std::reference_wrapper<const std::vector<ObjectTileHighlight>>> GetForTile(TileIndex tile) const;
-    MapTypeKeys GetAllTiles() const;
-    std::vector<TileIndex> UpdateWithMap(const HighlightMap &update);
-    void AddTileArea(const TileArea &area, SpriteID palette);
-    void AddTileAreaWithBorder(const TileArea &area, SpriteID palette);
-    void AddTilesBorder(const std::set<TileIndex> &tiles, SpriteID palette);
+    void GetTiles(TileIndex tile, HighlightMap &res);
 };
 
 
@@ -392,12 +404,12 @@ public:
     DiagDirection ddir = INVALID_DIAGDIR;
     RoadType roadtype = INVALID_ROADTYPE;
     bool is_truck = false;
-    RoadStopClassID road_stop_spec_class;
-    uint16_t w;
-    uint16_t h;
-    uint16_t road_stop_spec_index;
-    StationClassID rail_station_class;
-    uint16_t rail_station_type;
+    RoadStopClassID road_stop_spec_class{};
+    uint16_t w = 0;
+    uint16_t h = 0;
+    uint16_t road_stop_spec_index = 0;
+    StationClassID rail_station_class{};
+    uint16_t rail_station_type = 0;
     int airport_type = 0;
     uint8_t airport_layout = 0;
     sp<Blueprint> blueprint = nullptr;
@@ -408,7 +420,7 @@ public:
 
 protected:
     bool tiles_updated = false;
-    std::multimap<TileIndex, ObjectTileHighlight> tiles;
+    HighlightMap tiles;
     std::vector<DetachedHighlight> sprites = {};
     BuildInfoOverlayData overlay_data = {};
     // Point overlay_pos = {0, 0};
@@ -442,6 +454,7 @@ public:
     void AddStationOverlayData(int w, int h, int rad,  StationCoverageType sct);
     void UpdateTiles();
     void MarkDirty();
+    void MarkChangedPolyrailDirty(const ObjectHighlight &other);
 };
 
 typedef std::tuple<HighlightMap, BuildInfoOverlayData, CommandCost> ToolGUIInfo;
@@ -16,8 +16,8 @@
 #include "../widgets/rail_widget.h"
 #include "../widgets/road_widget.h"
 
+#include <array>
 #include <optional>
-#include <queue>
 
 #include "../safeguards.h"
 
@@ -35,14 +35,33 @@ bool _middle_button_clicked;  ///< Is middle mouse button clicked?
 
 static uint32 _effective_actions = 0;
 static std::optional<std::chrono::steady_clock::time_point> _first_effective_tick = {};
-static std::queue<std::chrono::steady_clock::time_point> _last_actions;
 
 const std::chrono::minutes EPM_PERIOD(1);  ///< Actions per minute measuring period is, suprisingly, one minute
-
-static void PurgeLastActions() {
-    auto now = std::chrono::steady_clock::now();
-    while (!_last_actions.empty() && _last_actions.front() <= now)
-        _last_actions.pop();
+static const size_t EPM_BUCKETS = std::chrono::duration_cast<std::chrono::seconds>(EPM_PERIOD).count();  ///< One bucket per second of the period
+
+static std::array<uint32, EPM_BUCKETS> _action_buckets = {};  ///< Actions counted in each second of the last period, as a ring
+static uint32 _last_period_actions = 0;  ///< Sum of all _action_buckets
+static int64_t _last_action_second = 0;  ///< Second the newest bucket belongs to
+
+/**
+ * Empty the buckets of the seconds that passed since the last update, so the ring covers the period ending now.
+ * @param now Current time.
+ * @return Bucket of the current second.
+ */
+static uint32 &AdvanceActionBuckets(std::chrono::steady_clock::time_point now) {
+    int64_t second = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+    if (second - _last_action_second >= (int64_t)EPM_BUCKETS) {
+        _action_buckets.fill(0);
+        _last_period_actions = 0;
+    } else {
+        for (int64_t s = _last_action_second + 1; s <= second; s++) {
+            auto &bucket = _action_buckets[s % EPM_BUCKETS];
+            _last_period_actions -= bucket;
+            bucket = 0;
+        }
+    }
+    _last_action_second = std::max(_last_action_second, second);
+    return _action_buckets[_last_action_second % EPM_BUCKETS];
 }
 
 void CountEffectiveAction() {
@@ -50,24 +69,25 @@ void CountEffectiveAction() {
     auto now = std::chrono::steady_clock::now();
     if (!_first_effective_tick) _first_effective_tick = now;
     _effective_actions++;
-    PurgeLastActions();
-    _last_actions.push(now + EPM_PERIOD);
+    AdvanceActionBuckets(now)++;
+    _last_period_actions++;
 }
 
 void ResetEffectiveActionCounter() {
     _first_effective_tick = {};
     _effective_actions = 0;
-    std::queue<std::chrono::steady_clock::time_point>().swap(_last_actions);  // clear the queue
+    _action_buckets.fill(0);
+    _last_period_actions = 0;
 }
 
 std::pair<uint32, uint32> GetEPM() {
     auto now = std::chrono::steady_clock::now();
     if (!_first_effective_tick) return std::make_pair(0, 0);
-    PurgeLastActions();
+    AdvanceActionBuckets(now);
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - *_first_effective_tick).count();
-    if (ms < 1000) return std::make_pair(0, _last_actions.size());
+    if (ms < 1000) return std::make_pair(0, _last_period_actions);
     return std::make_pair(_effective_actions * 60000 / ms,
-                          _last_actions.size());
+                          _last_period_actions);
 }
 
 bool HasSeparateRemoveMod() {
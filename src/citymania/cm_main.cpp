@@ -2,6 +2,7 @@
 
 #include "cm_main.hpp"
 #include "cm_command_type.hpp"
+#include "cm_export.hpp"
 #include "cm_hotkeys.hpp"
 #include "cm_minimap.hpp"
 
@@ -22,6 +23,7 @@ static IntervalTimer<TimerGameCalendar> _event_new_month({TimerGameCalendar::MON
 void ResetGame() {
     _game = make_up<Game>();
     ResetEffectiveActionCounter();
+    ResetWorldTilesExport();
 }
 
 void SwitchToMode(SwitchMode new_mode) {
@@ -501,7 +501,7 @@ static const AndOr _smallmap_vehicles_andor[] = {
 };
 
 /** Mapping of tile type to importance of the tile (higher number means more interesting to show). */
-static const uint8_t _tiletype_importance[] = {
+static constexpr uint8_t _tiletype_importance[] = {
 	2, // MP_CLEAR
 	8, // MP_RAILWAY
 	7, // MP_ROAD
@@ -515,6 +515,8 @@ static const uint8_t _tiletype_importance[] = {
 	2, // MP_OBJECT
 	0,
 };
+/** Highest value in #_tiletype_importance. */
+static constexpr uint8_t MAX_TILETYPE_IMPORTANCE = std::ranges::max(_tiletype_importance);
 
 
 /**
@@ -828,6 +830,7 @@ inline uint32 SmallMapWindow::GetTileColours(const TileArea &ta) const
 	int importance = 0;
 	TileIndex tile = INVALID_TILE; // Position of the most important tile.
 	TileType et = MP_VOID;         // Effective tile type at that position.
+	const bool check_industries = this->map_type == SMT_INDUSTRY || this->map_type == CM_SMT_IMBA;
 
 	for(TileIndex ti : ta) {
 		TileType ttype = GetTileType(ti);
@@ -846,7 +849,7 @@ inline uint32 SmallMapWindow::GetTileColours(const TileArea &ta) const
 
 			case MP_INDUSTRY:
 				/* Special handling of industries while in "Industries" smallmap view. */
-				if (this->map_type == SMT_INDUSTRY || this->map_type == CM_SMT_IMBA) {
+				if (check_industries) {
 					/* If industry is allowed to be seen, use its colour on the map.
 					 * This has the highest priority above any value in _tiletype_importance. */
 					IndustryType type = Industry::GetByTile(ti)->type;
@@ -871,6 +874,8 @@ inline uint32 SmallMapWindow::GetTileColours(const TileArea &ta) const
 			importance = _tiletype_importance[ttype];
 			tile = ti;
 			et = ttype;
+			/* Nothing can beat a station anymore, unless an industry later in the area overrides everything. */
+			if (importance == MAX_TILETYPE_IMPORTANCE && !check_industries) break;
 		}
 	}
 
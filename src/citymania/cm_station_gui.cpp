@@ -27,6 +27,7 @@
 #include "../tilehighlight_type.h"
 #include "../town_map.h"
 #include "../town.h"
+#include "../timer/timer_game_tick.h"
 #include "../viewport_func.h"
 #include "../viewport_kdtree.h"
 #include "../vehicle_base.h"
@@ -40,6 +41,7 @@
 #include <cassert>
 #include <complex>
 #include <cstdio>
+#include <map>
 #include <optional>
 #include <sstream>
 #include <unordered_set>
@@ -70,27 +72,39 @@ extern uint8_t _selected_airport_layout;          ///< selected airport layout n
 
 namespace citymania {
 
-// Copy of GetOrderDistance but returning both squared dist and manhattan
-std::pair<uint, uint> GetOrderDistances(VehicleOrderID prev, VehicleOrderID cur, const Vehicle *v, int conditional_depth)
+// Like GetOrderDistance but returning both squared dist and manhattan.
+// The result is the maximum distance from the previous order's destination to any
+// destination reachable from cur through conditional orders; each order is visited once.
+std::pair<uint, uint> GetOrderDistances(VehicleOrderID prev, VehicleOrderID cur, const Vehicle *v)
 {
     assert(v->orders != nullptr);
     const OrderList &orderlist = *v->orders;
     auto orders = orderlist.GetOrders();
 
-    if (orders[cur].IsType(OT_CONDITIONAL)) {
-        if (conditional_depth > v->GetNumOrders()) return {0, 0};
-
-        conditional_depth++;
+    TileIndex prev_tile = orders[prev].GetLocation(v, true);
+    if (prev_tile == INVALID_TILE) return {0, 0};
+
+    std::pair<uint, uint> res = {0, 0};
+    std::vector<bool> visited(orders.size(), false);
+    std::vector<VehicleOrderID> stack = {cur};
+    while (!stack.empty()) {
+        VehicleOrderID order = stack.back();
+        stack.pop_back();
+        if (order >= orders.size() || visited[order]) continue;
+        visited[order] = true;
+
+        if (orders[order].IsType(OT_CONDITIONAL)) {
+            stack.push_back(orders[order].GetConditionSkipToOrder());
+            stack.push_back(orderlist.GetNext(order));
+            continue;
+        }
 
-        auto dist1 = GetOrderDistances(prev, orders[cur].GetConditionSkipToOrder(), v, conditional_depth);
-        auto dist2 = GetOrderDistances(prev, orderlist.GetNext(cur), v, conditional_depth);
-        return {std::max(dist1.first, dist2.first), std::max(dist1.second, dist2.second)};
+        TileIndex cur_tile = orders[order].GetLocation(v, true);
+        if (cur_tile == INVALID_TILE) continue;
+        res.first = std::max(res.first, DistanceSquare(prev_tile, cur_tile));
+        res.second = std::max(res.second, DistanceManhattan(prev_tile, cur_tile));
     }
-
-    TileIndex prev_tile = orders[prev].GetLocation(v, true);
-    TileIndex cur_tile = orders[cur].GetLocation(v, true);
-    if (prev_tile == INVALID_TILE || cur_tile == INVALID_TILE) return {0, 0};
-    return {DistanceSquare(prev_tile, cur_tile), DistanceManhattan(prev_tile, cur_tile)};
+    return res;
 }
 
 bool UseImprovedStationJoin() {
@@ -398,8 +412,9 @@ static void AddProducedCargo_Town(TileIndex tile, CargoArray &produced)
     }
 }
 
-// Similar to ::GetProductionAroundTiles but counts production total
-CargoArray GetProductionAroundTiles(TileIndex tile, int w, int h, int rad)
+// Adds or removes the production of a single tile, industries are only counted
+// as they produce for the whole area however many of their tiles are in it.
+static void UpdateTileProduction(TileIndex tile, CargoArray &produced, std::map<IndustryID, uint> &industry_tiles, bool remove)
 {
     static const uint HQ_AVG_POP[2][5] = {
         {48, 64, 84, 128, 384},
@@ -410,37 +425,95 @@ CargoArray GetProductionAroundTiles(TileIndex tile, int w, int h, int rad)
         {36, 48, 64, 96, 196}
     };
 
-    CargoArray produced{};
-    std::set<IndustryID> industries;
-    TileArea ta = TileArea(tile, w, h).Expand(rad);
-
-    /* Loop over all tiles to get the produced cargo of
-     * everything except industries */
-    for(auto tile : ta) {
-        switch (GetTileType(tile)) {
-            case MP_INDUSTRY:
-                industries.insert(GetIndustryIndex(tile));
-                break;
-            case MP_HOUSE:
-                AddProducedCargo_Town(tile, produced);
+    CargoArray tile_produced{};
+    switch (GetTileType(tile)) {
+        case MP_INDUSTRY: {
+            auto it = industry_tiles.try_emplace(GetIndustryIndex(tile), 0).first;
+            if (!remove) {
+                it->second++;
+            } else if (--it->second == 0) {
+                industry_tiles.erase(it);
+            }
+            return;
+        }
+        case MP_HOUSE:
+            AddProducedCargo_Town(tile, tile_produced);
+            break;
+        case MP_OBJECT:
+            if (IsObjectType(tile, OBJECT_HQ)) {
+                auto pax_avg = GetMonthlyFrom256Tick(HQ_AVG_POP[EconomyIsInRecession() ? 1 : 0][GetAnimationFrame(tile)]);
+                auto mail_avg = GetMonthlyFrom256Tick(HQ_AVG_MAIL[EconomyIsInRecession() ? 1 : 0][GetAnimationFrame(tile)]);
+                for (const CargoSpec *cs : CargoSpec::town_production_cargoes[TPE_PASSENGERS])
+                    tile_produced[cs->Index()] += pax_avg;
+                for (const CargoSpec *cs : CargoSpec::town_production_cargoes[TPE_MAIL])
+                    tile_produced[cs->Index()] += mail_avg;
                 break;
-            case MP_OBJECT:
-                if (IsObjectType(tile, OBJECT_HQ)) {
-                    auto pax_avg = GetMonthlyFrom256Tick(HQ_AVG_POP[EconomyIsInRecession() ? 1 : 0][GetAnimationFrame(tile)]);
-                    auto mail_avg = GetMonthlyFrom256Tick(HQ_AVG_MAIL[EconomyIsInRecession() ? 1 : 0][GetAnimationFrame(tile)]);
-                    for (const CargoSpec *cs : CargoSpec::town_production_cargoes[TPE_PASSENGERS])
-                        produced[cs->Index()] += pax_avg;
-                    for (const CargoSpec *cs : CargoSpec::town_production_cargoes[TPE_MAIL])
-                        produced[cs->Index()] += mail_avg;
-                }
-            default: break;
+            }
+            return;
+        default: return;
+    }
+
+    for (CargoType c = 0; c < NUM_CARGO; c++) {
+        if (remove) {
+            produced[c] -= tile_produced[c];
+        } else {
+            produced[c] += tile_produced[c];
         }
     }
+}
 
-    /* Loop over the seen industries. They produce cargo for
+// Calls the function for every tile of area a that is not in area b.
+template <typename F>
+static void ForEachTileNotIn(const TileArea &a, const TileArea &b, F &&f)
+{
+    uint ax1 = TileX(a.tile), ay1 = TileY(a.tile), ax2 = ax1 + a.w, ay2 = ay1 + a.h;
+    uint bx1 = TileX(b.tile), by1 = TileY(b.tile), bx2 = bx1 + b.w, by2 = by1 + b.h;
+    if (b.w == 0) by2 = by1;
+    for (uint y = ay1; y < ay2; y++) {
+        if (y < by1 || y >= by2) {
+            for (uint x = ax1; x < ax2; x++) f(TileXY(x, y));
+            continue;
+        }
+        for (uint x = ax1; x < std::min(ax2, bx1); x++) f(TileXY(x, y));
+        for (uint x = std::max(ax1, bx2); x < ax2; x++) f(TileXY(x, y));
+    }
+}
+
+// Similar to ::GetProductionAroundTiles but counts production total.
+// Station placement asks for an area next to the previous one on every cursor
+// move, so the production of the last area is kept and only the tiles that left
+// or entered the area are counted again. The map only changes with a tick or a
+// command, so anything else starts from scratch.
+CargoArray GetProductionAroundTiles(TileIndex tile, int w, int h, int rad)
+{
+    static struct {
+        TileArea area{INVALID_TILE, 0, 0};
+        uint64_t tick = 0;
+        uint32_t commands_executed = 0;
+        CargoArray produced{};  ///< Production of everything except industries.
+        std::map<IndustryID, uint> industry_tiles;  ///< Number of tiles in the area of each seen industry.
+    } last;
+
+    TileArea ta = TileArea(tile, w, h).Expand(rad);
+
+    if (last.tick != TimerGameTick::counter || last.commands_executed != _commands_executed || !last.area.Intersects(ta)) {
+        last.area = TileArea(INVALID_TILE, 0, 0);
+        last.produced = {};
+        last.industry_tiles.clear();
+        last.tick = TimerGameTick::counter;
+        last.commands_executed = _commands_executed;
+    }
+
+    ForEachTileNotIn(last.area, ta, [](TileIndex t) { UpdateTileProduction(t, last.produced, last.industry_tiles, true); });
+    ForEachTileNotIn(ta, last.area, [](TileIndex t) { UpdateTileProduction(t, last.produced, last.industry_tiles, false); });
+    last.area = ta;
+
+    CargoArray produced = last.produced;
+
+    /* Add the seen industries. They produce cargo for
      * anything that is within 'rad' of any one of their tiles.
      */
-    for (IndustryID industry : industries) {
+    for (const auto &[industry, tiles] : last.industry_tiles) {
         const Industry *i = Industry::Get(industry);
         /* Skip industry with neutral station */
         if (i->neutral_station != nullptr && !_settings_game.station.serve_neutral_industries) continue;
@@ -612,6 +685,7 @@ bool IsHighlightCoverageStation(const Station *station) {
 }
 
 void OnStationRemoved(const Station *station) {
+    InvalidateStationCatchmentBorders(station);
     if (_last_built_station == station) _last_built_station = nullptr;
     if (auto mode = std::get_if<StationAction::Join>(&_station_action); mode && mode->station == station->index) {
         _station_action = StationAction::Create{};
@@ -723,7 +797,6 @@ static HighlightMap PrepareHighilightMap(Station *st_join, std::optional<ObjectH
 
     HighlightMap hlmap{};
     TileArea join_area;
-    std::set<TileIndex> coverage_area;
 
     if (show_join_area && st_join != nullptr) {
         join_area = GetStationJoinArea(st_join->index);
@@ -734,7 +807,6 @@ static HighlightMap PrepareHighilightMap(Station *st_join, std::optional<ObjectH
         // Add joining station coverage
         for (auto t : st_join->catchment_tiles) {
             hlmap.Add(t, ObjectTileHighlight::make_tint(CM_PALETTE_TINT_WHITE));
-            coverage_area.insert(t);
         }
     }
 
@@ -747,17 +819,38 @@ static HighlightMap PrepareHighilightMap(Station *st_join, std::optional<ObjectH
         xarea = ClampToVisibleMap(xarea);
         rad_area = xarea;
     }
-    if (show_coverage && add_current && rad_area.has_value()) {
+    if (!show_coverage || !add_current) rad_area = std::nullopt;
+    auto in_join_coverage = [&](TileIndex t) {
+        return show_coverage && st_join != nullptr && st_join->TileIsInCatchment(t);
+    };
+    auto in_coverage = [&](TileIndex t) {
+        return in_join_coverage(t) || (rad_area.has_value() && rad_area->Contains(t));
+    };
+
+    if (rad_area.has_value()) {
         // Add current station coverage
         for (auto t : *rad_area) {
-            if (coverage_area.find(t) != coverage_area.end()) continue;
+            if (in_join_coverage(t)) continue;
             hlmap.Add(t, ObjectTileHighlight::make_tint(CM_PALETTE_TINT_WHITE));
-            coverage_area.insert(t);
         }
     }
 
     if (show_coverage) {
-        hlmap.AddTilesBorder(coverage_area, CM_PALETTE_TINT_WHITE);
+        // Joining station border comes from the per-station cache, only the tiles
+        // next to the current station coverage need their borders recalculated.
+        std::optional<TileArea> changed_area = std::nullopt;
+        if (rad_area.has_value()) {
+            changed_area = *rad_area;
+            changed_area->Expand(1);
+            changed_area = ClampToVisibleMap(*changed_area);
+        }
+        if (st_join != nullptr) {
+            for (auto [t, b] : GetStationCatchmentBorder(st_join)) {
+                if (changed_area.has_value() && changed_area->Contains(t)) continue;
+                hlmap.Add(t, ObjectTileHighlight::make_border(CM_PALETTE_TINT_WHITE, b));
+            }
+        }
+        if (changed_area.has_value()) hlmap.AddTilesBorder(*changed_area, in_coverage, CM_PALETTE_TINT_WHITE);
     }
 
     if (st_join != nullptr) {
@@ -835,8 +928,106 @@ void RemoveAction::OnStationRemoved(const Station *) {}
 
 // --- PlacementAction ---
 
+/**
+ * Last placement preview with everything it was computed from.
+ * The cursor update runs every input loop while the test command, coverage and
+ * overlay strings only change when the placement does, when any command gets
+ * executed or when the game advances a tick.
+ */
+struct PlacementGUIInfoCache {
+    ObjectHighlight ohl;
+    Commands cmd;
+    std::vector<uint32_t> cmd_params;
+    StationID to_join;
+    bool adjacent;
+    bool picker;
+    bool show_coverage;
+    StationCoverageType sct;
+    uint rad;
+    CompanyID company;
+    uint64_t tick;
+    uint32_t commands_executed;
+    ToolGUIInfo info;
+
+    bool Matches(const PlacementGUIInfoCache &other) const {
+        return this->ohl == other.ohl
+            && this->cmd == other.cmd
+            && this->cmd_params == other.cmd_params
+            && this->to_join == other.to_join
+            && this->adjacent == other.adjacent
+            && this->picker == other.picker
+            && this->show_coverage == other.show_coverage
+            && this->sct == other.sct
+            && this->rad == other.rad
+            && this->company == other.company
+            && this->tick == other.tick
+            && this->commands_executed == other.commands_executed;
+    }
+};
+
+static std::optional<PlacementGUIInfoCache> _placement_gui_info_cache;
+
+template <typename T>
+static uint32_t GetCommandParamValue(T value) {
+    if constexpr (std::is_enum_v<T>) {
+        return to_underlying(value);
+    } else if constexpr (std::is_integral_v<T>) {
+        return value;
+    } else {
+        return value.base();
+    }
+}
+
+// All parameters of a placement command, as the highlight does not hold
+// all of them (e.g. the rail type of a rail station).
+static std::optional<std::vector<uint32_t>> GetPlacementCommandParams(Command *cmd) {
+    auto pack = [](auto... values) { return std::vector<uint32_t>{GetCommandParamValue(values)...}; };
+    if (auto c = dynamic_cast<cmd::BuildRailStation *>(cmd)) {
+        return pack(c->tile_org, c->rt, c->axis, c->numtracks, c->plat_len, c->spec_class, c->spec_index, c->station_to_join, c->adjacent);
+    }
+    if (auto c = dynamic_cast<cmd::BuildRoadStop *>(cmd)) {
+        return pack(c->tile, c->width, c->length, c->stop_type, c->is_drive_through, c->ddir, c->rt, c->spec_class, c->spec_index, c->station_to_join, c->adjacent);
+    }
+    if (auto c = dynamic_cast<cmd::BuildDock *>(cmd)) {
+        return pack(c->tile, c->station_to_join, c->adjacent);
+    }
+    if (auto c = dynamic_cast<cmd::BuildAirport *>(cmd)) {
+        return pack(c->tile, c->airport_type, c->layout, c->station_to_join, c->adjacent);
+    }
+    return std::nullopt;
+}
+
 ToolGUIInfo PlacementAction::PrepareGUIInfo(std::optional<ObjectHighlight> ohl, up<Command> cmd, StationCoverageType sct, uint rad) {
     if (cmd == nullptr || !ohl.has_value()) return {};
+
+    auto cmd_params = GetPlacementCommandParams(cmd.get());
+    if (!cmd_params.has_value()) return this->PrepareGUIInfoUncached(std::move(ohl), std::move(cmd), sct, rad);
+
+    PlacementGUIInfoCache key{
+        .ohl = ohl.value(),
+        .cmd = cmd->get_command(),
+        .cmd_params = std::move(*cmd_params),
+        .to_join = StationID::Invalid(),
+        .adjacent = false,
+        .picker = std::holds_alternative<StationAction::Picker>(_station_action),
+        .show_coverage = _settings_client.gui.station_show_coverage,
+        .sct = sct,
+        .rad = rad,
+        .company = _current_company,
+        .tick = TimerGameTick::counter,
+        .commands_executed = _commands_executed,
+        .info = {},
+    };
+    if (auto a = std::get_if<StationAction::Join>(&_station_action)) key.to_join = a->station;
+    if (auto station_cmd = dynamic_cast<StationBuildCommand *>(cmd.get())) key.adjacent = station_cmd->adjacent;
+    if (_placement_gui_info_cache.has_value() && _placement_gui_info_cache->Matches(key)) return _placement_gui_info_cache->info;
+
+    key.info = this->PrepareGUIInfoUncached(std::move(ohl), std::move(cmd), sct, rad);
+    _placement_gui_info_cache = std::move(key);
+    return _placement_gui_info_cache->info;
+}
+
+ToolGUIInfo PlacementAction::PrepareGUIInfoUncached(std::optional<ObjectHighlight> ohl, up<Command> cmd, StationCoverageType sct, uint rad) {
     ohl.value().UpdateTiles();
     auto palette = CM_PALETTE_TINT_WHITE;
     auto area = ohl.value().GetArea();
@@ -42,6 +42,7 @@ void OnStationRemoved(const Station *station);
 // void SelectStationToJoin(const Station *station);
 // const Station *GetStationToJoin();
 void MarkCoverageHighlightDirty();
+void MarkTileAreaDirty(const TileArea &ta);
 void AbortStationPlacement();
 
 std::optional<std::string> GetStationCoverageAreaText(TileIndex tile, int w, int h, int rad, StationCoverageType sct, bool supplies);
@@ -59,7 +60,7 @@ bool IsHighlightCoverageStation(const Station *station);
 bool HasSelectedStationHighlight();
 ToolGUIInfo GetSelectedStationGUIInfo();
 
-std::pair<uint, uint> GetOrderDistances(VehicleOrderID prev, VehicleOrderID cur, const Vehicle *v, int conditional_depth = 0);
+std::pair<uint, uint> GetOrderDistances(VehicleOrderID prev, VehicleOrderID cur, const Vehicle *v);
 
 template<typename Func>
 void IterateStation(TileIndex start_tile, Axis axis, uint8_t numtracks, uint8_t plat_len, Func visitor) {
@@ -116,6 +117,8 @@ class PlacementAction : public Action {
 public:
     ~PlacementAction() override = default;
     ToolGUIInfo PrepareGUIInfo(std::optional<ObjectHighlight> ohl, up<Command> cmd, StationCoverageType sct, uint rad);
+private:
+    ToolGUIInfo PrepareGUIInfoUncached(std::optional<ObjectHighlight> ohl, up<Command> cmd, StationCoverageType sct, uint rad);
 };
 
 class SizedPlacementAction : public PlacementAction {
@@ -9,8 +9,9 @@
 namespace citymania {
 
 void SurveyGameSession(nlohmann::json &survey) {
+    auto &hotkeys = survey["cm_hotkeys"];
     for (auto& [key, value]: _game_session_stats.cm.hotkeys) {
-        survey["cm_hotkeys"][key] = value;
+        hotkeys[key] = value;
     }
 }
 
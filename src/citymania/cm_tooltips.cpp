@@ -41,10 +41,12 @@ struct LandTooltipsWindow : public Window
 {
     TileType tiletype;
     uint16 objIndex;
+    uint param;
 
     LandTooltipsWindow(Window *parent, uint param) : Window(_land_tooltips_desc)
     {
         this->parent = parent;
+        this->param = param;
         this->tiletype = (TileType)(param & 0xFFFF);
         this->objIndex = (uint16)((param >> 16) & 0xFFFF);
         this->InitNested();
@@ -261,6 +263,19 @@ void ShowLandTooltips(TileIndex tile, Window *parent) {
         default:
             break;
     }
+    // Moving between tiles of the same house, industry or station keeps the
+    // tooltip and only moves it, so its text is not measured again.
+    auto w = dynamic_cast<LandTooltipsWindow *>(FindWindowById(CM_WC_LAND_TOOLTIPS, 0));
+    if (w != nullptr && param != 0 && w->param == param && w->parent == parent) {
+        Point pt = w->OnInitialPosition(w->width, w->height, 0);
+        if (pt.x != w->left || pt.y != w->top) {
+            w->SetDirty();
+            w->left = pt.x;
+            w->top = pt.y;
+            w->SetDirty();
+        }
+        return;
+    }
     CloseWindowById(CM_WC_LAND_TOOLTIPS, 0);
 
     if (param == 0) return;
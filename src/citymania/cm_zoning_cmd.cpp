@@ -10,6 +10,7 @@
 #include "../industry.h"
 #include "../viewport_func.h"
 #include "../town.h"
+#include "../town_kdtree.h"
 #include "../genworld.h"
 
 #include <algorithm>
@@ -23,55 +24,39 @@ Zoning _zoning = {EvaluationMode::CHECKNOTHING, EvaluationMode::CHECKNOTHING};
 static const SpriteID INVALID_SPRITE_ID = UINT_MAX;
 //RED GREEN BLACK LIGHT_BLUE ORANGE WHITE YELLOW PURPLE
 
-TileIndex _closest_cache_ref = INVALID_TILE;
-const uint CLOSEST_CACHE_THRESHOLD = 128;
-typedef std::pair<uint, Town*>ClosestTownRecord;
-std::vector<ClosestTownRecord> _closest_cache;
-
-
-void RebuildClosestHash(TileIndex tile) {
-	_closest_cache_ref = INVALID_TILE;
-	_closest_cache.clear();
-	for (Town *t : Town::Iterate()) {
-		_closest_cache.push_back(std::make_pair(
-		    DistanceManhattan(t->xy, tile), t));
-	}
-	std::sort(
-	    _closest_cache.begin(), _closest_cache.end(),
-		[](ClosestTownRecord &a, ClosestTownRecord &b) -> bool {
-	    	return a.first < b.first;
-		}
-	);
-
-	_closest_cache_ref = tile;
-}
-
-
+/**
+ * Find the closest town to the tile using the town kdtree.
+ * The kdtree nearest query is Euclidean, so its result only gives an upper
+ * bound for the Manhattan distance; the towns inside that bound are then
+ * compared by Manhattan distance like the full scan did.
+ * @param tile Tile to search from.
+ * @param threshold Biggest allowed distance to the town.
+ * @return Closest town within \a threshold or nullptr.
+ */
 Town *CMCalcClosestTownFromTile(TileIndex tile, uint threshold = INT_MAX)
 {
-	if (_closest_cache_ref == INVALID_TILE
-	    	|| DistanceManhattan(_closest_cache_ref, tile) > CLOSEST_CACHE_THRESHOLD) {
-		RebuildClosestHash(tile);
-		// RebuildClosestHash(TileXY(
-		//     TileX(tile) + CLOSEST_CACHE_THRESHOLD / 2,
-		//     TileY(tile) + CLOSEST_CACHE_THRESHOLD / 2));
-	}
-	int ref_dist = DistanceManhattan(_closest_cache_ref, tile);
-
-	uint best = threshold;
-	Town *best_town = NULL;
-
-	for (auto p: _closest_cache) {
-		if (p.first > best + ref_dist)
-			break;
-		uint dist = DistanceManhattan(tile, p.second->xy);
-		if (dist < best) {
-			best = dist;
-			best_town = p.second;
+	if (_town_kdtree.Count() == 0) return nullptr;
+
+	uint best_dist = DistanceManhattan(tile, Town::Get(_town_kdtree.FindNearest(TileX(tile), TileY(tile)))->xy);
+	if (best_dist >= threshold) best_dist = threshold - 1;
+
+	uint x = TileX(tile);
+	uint y = TileY(tile);
+	uint x1 = x - std::min(x, best_dist);
+	uint y1 = y - std::min(y, best_dist);
+	uint x2 = std::min<uint>(x + best_dist, Map::MaxX()) + 1;
+	uint y2 = std::min<uint>(y + best_dist, Map::MaxY()) + 1;
+
+	Town *best = nullptr;
+	_town_kdtree.FindContained(x1, y1, x2, y2, [&](TownID tid) {
+		Town *t = Town::Get(tid);
+		uint dist = DistanceManhattan(tile, t->xy);
+		if (dist < threshold && (best == nullptr || dist < best_dist || (dist == best_dist && t->index < best->index))) {
+			best = t;
+			best_dist = dist;
 		}
-	}
-
-	return best_town;
+	});
+	return best;
 }
 
 // Copy ClosestTownFromTile but uses CMCalcClosestTownFromTile
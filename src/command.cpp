@@ -394,6 +394,7 @@ CommandCost CommandHelperBase::InternalExecuteProcessResult(Commands cmd, Comman
 	}
 
 	citymania::UpdateWatching(_current_company, tile);
+	citymania::_commands_executed++;
 
 	SubtractMoneyFromCompany(res_exec);
 
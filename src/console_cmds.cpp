@@ -41,10 +41,13 @@
 #include "engine_base.h"
 #include "road.h"
 #include "rail.h"
+#include "pathfinder/yapf/yapf.h"
 #include "game/game.hpp"
 #include "3rdparty/fmt/chrono.h"
 #include "company_cmd.h"
 #include "misc_cmd.h"
+#include "spritecache.h"
+#include "core/pool_type.hpp"
 
 #if defined(WITH_ZLIB)
 #include "network/network_content.h"
@@ -1688,6 +1691,26 @@ static bool ConGetSysDate(std::span<std::string_view> argv)
 	return true;
 }
 
+static bool ConMemory(std::span<std::string_view> argv)
+{
+	if (argv.empty()) {
+		IConsolePrint(CC_HELP, "Show the memory used by the item pools and the sprite cache. Usage: 'memory'.");
+		return true;
+	}
+
+	size_t total = 0;
+	for (const PoolBase *pool : *PoolBase::GetPools()) {
+		PoolBase::MemoryUsage usage = pool->GetMemoryUsage();
+		if (usage.items == 0 && usage.index_bytes == 0) continue;
+		IConsolePrint(CC_DEFAULT, "{:<22} {:>7} items {:>9} KiB items {:>7} KiB index", usage.name, usage.items, usage.item_bytes / 1024, usage.index_bytes / 1024);
+		total += usage.item_bytes + usage.index_bytes;
+	}
+	IConsolePrint(CC_DEFAULT, "{:<22} {:>33} KiB", "Pools total", total / 1024);
+	IConsolePrint(CC_DEFAULT, "{:<22} {:>33} KiB", "Sprite cache", GetSpriteCacheUsage() / 1024);
+	IConsolePrint(CC_DEFAULT, "{:<22} {:>33} KiB", "Map", Map::GetTileArraysSize() / 1024);
+	return true;
+}
+
 static bool ConAlias(std::span<std::string_view> argv)
 {
 	IConsoleAlias *alias;
@@ -2540,8 +2563,12 @@ static bool ConNewGRFProfile(std::span<std::string_view> argv)
 		IConsolePrint(CC_HELP, "  Unselect one or more GRFs from profiling. Use the keyword \"all\" instead of a GRF number to unselect all. Removing an active profiler aborts data collection.");
 		IConsolePrint(CC_HELP, "Usage: 'newgrf_profile start [<num-ticks>]':");
 		IConsolePrint(CC_HELP, "  Begin profiling all selected GRFs. If a number of ticks is provided, profiling stops after that many game ticks. There are 74 ticks in a calendar day.");
+		IConsolePrint(CC_HELP, "Usage: 'newgrf_profile aggregate':");
+		IConsolePrint(CC_HELP, "  Begin profiling all selected GRFs, only collecting the totals per feature and callback. This keeps running until stopped.");
+		IConsolePrint(CC_HELP, "Usage: 'newgrf_profile summary [<count>]':");
+		IConsolePrint(CC_HELP, "  List the feature and callback combinations of the active profiles that took the most time so far, without stopping.");
 		IConsolePrint(CC_HELP, "Usage: 'newgrf_profile stop':");
-		IConsolePrint(CC_HELP, "  End profiling and write the collected data to CSV files.");
+		IConsolePrint(CC_HELP, "  End profiling and write the collected data to CSV files, or print the totals of aggregated profiles.");
 		IConsolePrint(CC_HELP, "Usage: 'newgrf_profile abort':");
 		IConsolePrint(CC_HELP, "  End profiling and discard all collected data.");
 		return true;
@@ -2634,6 +2661,46 @@ static bool ConNewGRFProfile(std::span<std::string_view> argv)
 		return true;
 	}
 
+	/* "aggregate" sub-command */
+	if (StrStartsWithIgnoreCase(argv[1], "agg")) {
+		size_t started = 0;
+		for (NewGRFProfiler &pr : _newgrf_profilers) {
+			if (!pr.active) {
+				pr.Start(true);
+				started++;
+			}
+		}
+		if (started > 0) {
+			IConsolePrint(CC_DEBUG, "Started aggregated profiling for {} GRF{}.", started, (started > 1) ? "s" : "");
+		} else if (_newgrf_profilers.empty()) {
+			IConsolePrint(CC_ERROR, "No GRFs selected for profiling, did not start.");
+		} else {
+			IConsolePrint(CC_ERROR, "Did not start profiling for any GRFs, all selected GRFs are already profiling.");
+		}
+		return true;
+	}
+
+	/* "summary" sub-command */
+	if (StrStartsWithIgnoreCase(argv[1], "sum")) {
+		size_t count = 10;
+		if (argv.size() >= 3) {
+			auto lines = ParseInteger(argv[2]);
+			if (!lines.has_value() || *lines < 1) {
+				IConsolePrint(CC_ERROR, "'{}' is not a valid line count.", argv[2]);
+				return true;
+			}
+			count = *lines;
+		}
+		bool any = false;
+		for (const NewGRFProfiler &pr : _newgrf_profilers) {
+			if (!pr.active) continue;
+			pr.PrintSummary(count);
+			any = true;
+		}
+		if (!any) IConsolePrint(CC_ERROR, "No NewGRFs are being profiled.");
+		return true;
+	}
+
 	/* "stop" sub-command */
 	if (StrStartsWithIgnoreCase(argv[1], "sto")) {
 		NewGRFProfiler::FinishAll();
@@ -2692,6 +2759,37 @@ static bool ConFramerateWindow(std::span<std::string_view> argv)
 	return true;
 }
 
+static bool ConYapfStatistics(std::span<std::string_view> argv)
+{
+	if (argv.empty()) {
+		IConsolePrint(CC_HELP, "Show cumulative pathfinder statistics per vehicle type. Usage: 'yapf_stats [reset]'.");
+		return true;
+	}
+
+	if (argv.size() > 2) return false;
+
+	if (argv.size() == 2) {
+		if (!StrEqualsIgnoreCase(argv[1], "reset")) return false;
+		_yapf_statistics = {};
+		IConsolePrint(CC_DEFAULT, "Pathfinder statistics reset.");
+		return true;
+	}
+
+	static const std::pair<VehicleType, std::string_view> types[] = {
+		{VEH_TRAIN, "Rail"},
+		{VEH_ROAD, "Road"},
+		{VEH_SHIP, "Ship"},
+	};
+	for (const auto &[type, name] : types) {
+		const YapfStatistics &stats = _yapf_statistics[type];
+		const uint64_t lookups = stats.cache_hits + stats.cache_misses;
+		IConsolePrint(CC_DEFAULT, "{}: {} calls, {} ms, {} closed, {} open, {} cache hits ({:.1f}%)",
+			name, stats.calls, stats.microseconds / 1000, stats.nodes_closed, stats.nodes_open,
+			stats.cache_hits, lookups == 0 ? 0.0 : stats.cache_hits * 100.0 / lookups);
+	}
+	return true;
+}
+
 /**
  * Format a label as a string.
  * If all elements are visible ASCII (excluding space) then the label will be formatted as a string of 4 characters,
@@ -2891,6 +2989,7 @@ void IConsoleStdLibRegister()
 	IConsole::CmdRegister("getseed",                 ConGetSeed);
 	IConsole::CmdRegister("getdate",                 ConGetDate);
 	IConsole::CmdRegister("getsysdate",              ConGetSysDate);
+	IConsole::CmdRegister("memory",                  ConMemory);
 	IConsole::CmdRegister("quit",                    ConExit);
 	IConsole::CmdRegister("resetengines",            ConResetEngines,     ConHookNoNetwork);
 	IConsole::CmdRegister("reset_enginepool",        ConResetEnginePool,  ConHookNoNetwork);
@@ -3008,6 +3107,7 @@ void IConsoleStdLibRegister()
 #endif
 	IConsole::CmdRegister("fps",                     ConFramerate);
 	IConsole::CmdRegister("fps_wnd",                 ConFramerateWindow);
+	IConsole::CmdRegister("yapf_stats",              ConYapfStatistics);
 
 	/* NewGRF development stuff */
 	IConsole::CmdRegister("reload_newgrfs",          ConNewGRFReload,     ConHookNewGRFDeveloperTool);
@@ -3016,6 +3116,7 @@ void IConsoleStdLibRegister()
 	IConsole::CmdRegister("dump_info",               ConDumpInfo);
 
 	IConsole::CmdRegister("cmexport", citymania::ConExport);
+	IConsole::CmdRegister("cmexporttiles", citymania::ConExportTiles);
 	IConsole::CmdRegister("cmtreemap", citymania::ConTreeMap, ConHookNoNetwork);
 
 	IConsole::CmdRegister("cmstep", citymania::ConStep);
@@ -3025,6 +3126,7 @@ void IConsoleStdLibRegister()
 	IConsole::CmdRegister("cmstartrecord", citymania::ConStartRecord);
 	IConsole::CmdRegister("cmstoprecord", citymania::ConStopRecord);
 	IConsole::CmdRegister("cmgamestats", citymania::ConGameStats);
+	IConsole::CmdRegister("cmstatehash", citymania::ConStateHash);
 
 	IConsole::CmdRegister("cmgfxdebug", citymania::ConGfxDebug);
 }
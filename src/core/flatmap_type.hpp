@@ -0,0 +1,97 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file flatmap_type.hpp Flat map container implementation. */
+
+#ifndef FLATMAP_TYPE_HPP
+#define FLATMAP_TYPE_HPP
+
+/**
+ * Flat map implementation that uses a sorted vector for storage.
+ * This is subset of functionality implemented by std::flat_map in c++23.
+ * Lookups are binary searches over contiguous memory, and inserting keys in
+ * ascending order, which is how maps are usually rebuilt, only appends.
+ * @tparam Tkey key type.
+ * @tparam Tvalue value type.
+ * @tparam Tcompare key comparator.
+ */
+template <class Tkey, class Tvalue, class Tcompare = std::less<>>
+class FlatMap {
+public:
+	using value_type = std::pair<Tkey, Tvalue>;
+	using const_iterator = std::vector<value_type>::const_iterator;
+	using const_reverse_iterator = std::vector<value_type>::const_reverse_iterator;
+
+private:
+	std::vector<value_type> data; ///< Vector of key and value pairs, sorted by key.
+
+	/** Compare the key of an element with a key. */
+	static bool KeyLess(const value_type &element, const Tkey &key) { return Tcompare{}(element.first, key); }
+	/** Compare a key with the key of an element. */
+	static bool LessKey(const Tkey &key, const value_type &element) { return Tcompare{}(key, element.first); }
+
+public:
+	/**
+	 * Get the value of a key, inserting a default constructed value if the key does not exist yet.
+	 * @param key Key to look up.
+	 * @return Reference to the value of the key.
+	 */
+	Tvalue &operator[](const Tkey &key)
+	{
+		if (this->data.empty() || Tcompare{}(this->data.back().first, key)) return this->data.emplace_back(key, Tvalue{}).second;
+
+		auto it = std::lower_bound(std::begin(this->data), std::end(this->data), key, KeyLess);
+		if (Tcompare{}(key, it->first)) it = this->data.emplace(it, key, Tvalue{});
+		return it->second;
+	}
+
+	/**
+	 * Find the element with the given key.
+	 * @param key Key to look up.
+	 * @return Iterator to the element, or end() if the key does not exist.
+	 */
+	const_iterator find(const Tkey &key) const
+	{
+		auto it = std::lower_bound(std::cbegin(this->data), std::cend(this->data), key, KeyLess);
+		if (it == std::cend(this->data) || Tcompare{}(key, it->first)) return std::cend(this->data);
+		return it;
+	}
+
+	/**
+	 * Find the first element with a key greater than the given key.
+	 * @param key Key to compare with.
+	 * @return Iterator to the element, or end() if there is none.
+	 */
+	const_iterator upper_bound(const Tkey &key) const
+	{
+		return std::upper_bound(std::cbegin(this->data), std::cend(this->data), key, LessKey);
+	}
+
+	/**
+	 * Swap the contents with another map.
+	 * @param other Map to swap with.
+	 */
+	void swap(FlatMap &other) { this->data.swap(other.data); }
+
+	const_iterator begin() const { return std::cbegin(this->data); }
+	const_iterator end() const { return std::cend(this->data); }
+
+	const_iterator cbegin() const { return std::cbegin(this->data); }
+	const_iterator cend() const { return std::cend(this->data); }
+
+	const_reverse_iterator rbegin() const { return std::crbegin(this->data); }
+	const_reverse_iterator rend() const { return std::crend(this->data); }
+
+	size_t size() const { return std::size(this->data); }
+	bool empty() const { return this->data.empty(); }
+
+	void clear() { this->data.clear(); }
+
+	auto operator<=>(const FlatMap<Tkey, Tvalue, Tcompare> &) const = default;
+};
+
+#endif /* FLATMAP_TYPE_HPP */
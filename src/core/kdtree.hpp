@@ -118,29 +118,83 @@ class Kdtree {
 		return true;
 	}
 
-	/** Insert one element in the tree somewhere below node_idx */
-	void InsertRecursive(const T &element, size_t node_idx, int level)
+	/** Count the number of elements in the sub-tree below and including node_idx */
+	size_t CountSubtree(size_t node_idx) const
 	{
-		/* Dimension index of current level */
-		int dim = level % 2;
-		/* Node reference */
-		node &n = this->nodes[node_idx];
+		if (node_idx == INVALID_NODE) return 0;
+		const node &n = this->nodes[node_idx];
+		return 1 + this->CountSubtree(n.left) + this->CountSubtree(n.right);
+	}
 
-		/* Coordinate of element splitting at this node */
-		CoordT nc = TxyFunc()(n.element, dim);
-		/* Coordinate of the new element */
-		CoordT ec = TxyFunc()(element, dim);
-		/* Which side to insert on */
-		size_t &next = (ec < nc) ? n.left : n.right;
-
-		if (next == INVALID_NODE) {
-			/* New leaf */
-			size_t newidx = this->AddNode(element);
-			/* Vector may have been reallocated at this point, n and next are invalid */
-			node &nn = this->nodes[node_idx];
-			if (ec < nc) nn.left = newidx; else nn.right = newidx;
+	/**
+	 * Get the depth a tree with the given number of elements may reach before
+	 * it is considered unbalanced, i.e. log base 3/2 of count.
+	 */
+	static size_t MaxBalancedDepth(size_t count)
+	{
+		size_t depth = 0;
+		for (; count > 1; count = count * 2 / 3) depth++;
+		return depth;
+	}
+
+	/**
+	 * Insert one element in the tree. If the new leaf ends up too deep,
+	 * rebuild only the lowest sub-tree on its path that is out of balance.
+	 * This is the scapegoat tree approach, with a balance factor of 2/3.
+	 */
+	void InsertBalanced(const T &element)
+	{
+		/* Nodes from the root down to the new leaf */
+		std::vector<size_t> path;
+		size_t node_idx = this->root;
+		for (int level = 0;; level++) {
+			path.push_back(node_idx);
+			const node &n = this->nodes[node_idx];
+			int dim = level % 2;
+			bool left = TxyFunc()(element, dim) < TxyFunc()(n.element, dim);
+			size_t next = left ? n.left : n.right;
+			if (next == INVALID_NODE) {
+				size_t newidx = this->AddNode(element);
+				/* Vector may have been reallocated at this point, n is invalid */
+				node &nn = this->nodes[node_idx];
+				if (left) nn.left = newidx; else nn.right = newidx;
+				path.push_back(newidx);
+				break;
+			}
+			node_idx = next;
+		}
+
+		if (path.size() - 1 <= MaxBalancedDepth(this->Count())) return;
+
+		/* Walk back up, and find the first node whose child on the path holds more than 2/3 of its elements */
+		size_t size = 1;
+		for (size_t i = path.size() - 1; i-- > 0;) {
+			const node &n = this->nodes[path[i]];
+			size_t sibling = (n.left == path[i + 1]) ? n.right : n.left;
+			size_t total = size + 1 + this->CountSubtree(sibling);
+			if (size * 3 > total * 2) {
+				this->RebuildSubtree(path, i);
+				return;
+			}
+			size = total;
+		}
+	}
+
+	/** Rebuild the sub-tree rooted at path[level], making it fully balanced */
+	void RebuildSubtree(const std::vector<size_t> &path, size_t level)
+	{
+		size_t subtree_idx = path[level];
+		T subtree_element = this->nodes[subtree_idx].element;
+		std::vector<T> elements = this->FreeSubtree(subtree_idx);
+		elements.push_back(subtree_element);
+		this->free_list.push_back(subtree_idx);
+
+		size_t newidx = this->BuildSubtree(elements.begin(), elements.end(), static_cast<int>(level));
+		if (level == 0) {
+			this->root = newidx;
 		} else {
-			this->InsertRecursive(element, next, level + 1);
+			node &parent = this->nodes[path[level - 1]];
+			if (parent.left == subtree_idx) parent.left = newidx; else parent.right = newidx;
 		}
 	}
 
@@ -390,7 +444,8 @@ public:
 
 	/**
 	 * Insert a single element in the tree.
-	 * Repeatedly inserting single elements may cause the tree to become unbalanced.
+	 * When an insert makes a branch too deep only the unbalanced sub-tree is rebuilt,
+	 * so the cost of rebalancing is spread over many inserts.
 	 * Undefined behaviour if the element already exists in the tree.
 	 */
 	void Insert(const T &element)
@@ -398,10 +453,7 @@ public:
 		if (this->Count() == 0) {
 			this->root = this->AddNode(element);
 		} else {
-			if (!this->IsUnbalanced() || !this->Rebuild(&element, nullptr)) {
-				this->InsertRecursive(element, this->root, 0);
-				this->IncrementUnbalanced();
-			}
+			this->InsertBalanced(element);
 			this->CheckInvariant();
 		}
 	}
@@ -200,6 +200,15 @@ DEFINE_POOL_METHOD(void)::CleanPool()
 	}
 }
 
+/**
+ * Reports the memory used by this pool.
+ * @return The number of items, the bytes they occupy and the bytes reserved for the index.
+ */
+DEFINE_POOL_METHOD(PoolBase::MemoryUsage)::GetMemoryUsage() const
+{
+	return {this->name, this->items, this->items * sizeof(Titem), this->data.capacity() * sizeof(Titem *) + this->used_bitmap.capacity() * sizeof(BitmapStorage)};
+}
+
 #undef DEFINE_POOL_METHOD
 
 /**
@@ -211,6 +220,7 @@ DEFINE_POOL_METHOD(void)::CleanPool()
 	template void * name ## Pool::GetNew(size_t size); \
 	template void * name ## Pool::GetNew(size_t size, size_t index); \
 	template void name ## Pool::FreeItem(size_t size, size_t index); \
-	template void name ## Pool::CleanPool();
+	template void name ## Pool::CleanPool(); \
+	template PoolBase::MemoryUsage name ## Pool::GetMemoryUsage() const;
 
 #endif /* POOL_FUNC_HPP */
@@ -10,6 +10,7 @@
 #ifndef POOL_TYPE_HPP
 #define POOL_TYPE_HPP
 
+#include "bitmath_func.hpp"
 #include "enum_type.hpp"
 
 /** Various types of a pool. */
@@ -111,6 +112,20 @@ struct PoolBase {
 	 */
 	virtual void CleanPool() = 0;
 
+	/** Memory used by a single pool, as reported by the 'memory' console command. */
+	struct MemoryUsage {
+		std::string_view name; ///< Name of the pool.
+		size_t items; ///< Number of items in the pool.
+		size_t item_bytes; ///< Bytes used by the items themselves, not counting memory they own.
+		size_t index_bytes; ///< Bytes reserved for the index and the used bitmap.
+	};
+
+	/**
+	 * Virtual method that reports the memory used by this pool.
+	 * @return The memory usage of this pool.
+	 */
+	virtual MemoryUsage GetMemoryUsage() const = 0;
+
 private:
 	/**
 	 * Dummy private copy constructor to prevent compilers from
@@ -152,6 +167,7 @@ public:
 
 	Pool(std::string_view name) : PoolBase(Tpool_type), name(name) {}
 	void CleanPool() override;
+	MemoryUsage GetMemoryUsage() const override;
 
 	/**
 	 * Returns Titem with given index
@@ -175,6 +191,23 @@ public:
 		return index < this->first_unused && this->Get(index) != nullptr;
 	}
 
+	/**
+	 * Finds the first index, starting at the given one, that is marked as used.
+	 * Sparse pools are skipped a whole bitmap word at a time.
+	 * @param index index to start searching from
+	 * @return index of the first used slot, or a value >= first_unused if there is none
+	 * @note While cleaning the pool freed items stay marked, so the result must still be validated.
+	 */
+	inline size_t FindFirstUsed(size_t index) const
+	{
+		while (index < this->first_unused) {
+			BitmapStorage used = this->used_bitmap[index / BITMAP_SIZE] >> (index % BITMAP_SIZE);
+			if (used != 0) return index + FindFirstBit(used);
+			index = (index / BITMAP_SIZE + 1) * BITMAP_SIZE;
+		}
+		return index;
+	}
+
 	/**
 	 * Tests whether we can allocate 'n' items
 	 * @param n number of items we want to allocate
@@ -214,8 +247,12 @@ public:
 		size_t index;
 		void ValidateIndex()
 		{
-			while (this->index < T::GetPoolSize() && !(T::IsValidID(this->index))) this->index++;
-			if (this->index >= T::GetPoolSize()) this->index = T::Pool::MAX_SIZE;
+			for (;; this->index++) {
+				this->index = T::FindFirstUsedIndex(this->index);
+				if (this->index >= T::GetPoolSize()) break;
+				if (T::IsValidID(this->index)) return;
+			}
+			this->index = T::Pool::MAX_SIZE;
 		}
 	};
 
@@ -258,8 +295,12 @@ public:
 		F filter;
 		void ValidateIndex()
 		{
-			while (this->index < T::GetPoolSize() && !(T::IsValidID(this->index) && this->filter(this->index))) this->index++;
-			if (this->index >= T::GetPoolSize()) this->index = T::Pool::MAX_SIZE;
+			for (;; this->index++) {
+				this->index = T::FindFirstUsedIndex(this->index);
+				if (this->index >= T::GetPoolSize()) break;
+				if (T::IsValidID(this->index) && this->filter(this->index)) return;
+			}
+			this->index = T::Pool::MAX_SIZE;
 		}
 	};
 
@@ -410,6 +451,16 @@ public:
 			return Tpool->first_unused;
 		}
 
+		/**
+		 * Returns the first index, starting at the given one, that may hold a valid item.
+		 * @param index index to start searching from
+		 * @return candidate index, or a value >= GetPoolSize() if there is none
+		 */
+		static inline size_t FindFirstUsedIndex(size_t index)
+		{
+			return Tpool->FindFirstUsed(index);
+		}
+
 		/**
 		 * Returns number of valid items in the pool
 		 * @return number of valid items in the pool
@@ -109,50 +109,89 @@ Economy _economy;
 Prices _price;
 static PriceMultipliers _price_base_multiplier;
 
+/** Per company totals of the stations and vehicles, as needed for the company value and rating. */
+struct CompanyAssetStats {
+	Money asset_value = 0; ///< Value of the stations and vehicles.
+	uint station_facilities = 0; ///< Number of facilities of all stations.
+	uint serviced_facilities = 0; ///< Number of facilities of stations that are actually serviced.
+	uint profitable_vehicles = 0; ///< Number of primary vehicles with a profit last year.
+	Money min_profit = 0; ///< Lowest profit last year of the old enough primary vehicles.
+	bool min_profit_first = true; ///< Whether no vehicle has been counted for #min_profit yet.
+};
+
+using CompanyAssetStatsList = TypedIndexContainer<std::array<CompanyAssetStats, MAX_COMPANIES>, CompanyID>;
+
 /**
- * Calculate the value of the assets of a company.
- *
- * @param c The company to calculate the value of.
- * @return The value of the assets of the company.
+ * Gather the station and vehicle totals of all companies.
+ * All companies are done at once, as a single pass over the pools costs the
+ * same as looking for the stations and vehicles of only one company.
+ * @param[out] stats The totals of each company.
  */
-static Money CalculateCompanyAssetValue(const Company *c)
+static void GatherCompanyAssetStats(CompanyAssetStatsList &stats)
 {
-	Owner owner = c->index;
-
-	uint num = 0;
+	stats.fill({});
 
 	for (const Station *st : Station::Iterate()) {
-		if (st->owner == owner) num += st->facilities.Count();
+		if (st->owner >= MAX_COMPANIES) continue;
+
+		CompanyAssetStats &cs = stats[st->owner];
+		uint facilities = st->facilities.Count();
+		cs.station_facilities += facilities;
+		/* Only count stations that are actually serviced */
+		if (st->time_since_load <= 20 || st->time_since_unload <= 20) cs.serviced_facilities += facilities;
 	}
 
-	Money value = num * _price[PR_STATION_VALUE] * 25;
+	for (CompanyAssetStats &cs : stats) {
+		cs.asset_value = cs.station_facilities * _price[PR_STATION_VALUE] * 25;
+	}
 
 	for (const Vehicle *v : Vehicle::Iterate()) {
-		if (v->owner != owner) continue;
+		if (v->owner >= MAX_COMPANIES) continue;
 
+		CompanyAssetStats &cs = stats[v->owner];
 		if (v->type == VEH_TRAIN ||
 				v->type == VEH_ROAD ||
 				(v->type == VEH_AIRCRAFT && Aircraft::From(v)->IsNormalAircraft()) ||
 				v->type == VEH_SHIP) {
-			value += v->value * 3 >> 1;
+			cs.asset_value += v->value * 3 >> 1;
+		}
+
+		if (IsCompanyBuildableVehicleType(v->type) && v->IsPrimaryVehicle()) {
+			if (v->profit_last_year > 0) cs.profitable_vehicles++; // For the vehicle score only count profitable vehicles
+			if (v->economy_age > VEHICLE_PROFIT_MIN_AGE) {
+				/* Find the vehicle with the lowest amount of profit */
+				if (cs.min_profit_first || cs.min_profit > v->profit_last_year) {
+					cs.min_profit = v->profit_last_year;
+					cs.min_profit_first = false;
+				}
+			}
 		}
 	}
+}
 
-	return value;
+/**
+ * Calculate the value of the assets of a company.
+ *
+ * @param c The company to calculate the value of.
+ * @return The value of the assets of the company.
+ */
+static Money CalculateCompanyAssetValue(const Company *c)
+{
+	CompanyAssetStatsList stats;
+	GatherCompanyAssetStats(stats);
+	return stats[c->index].asset_value;
 }
 
 /**
- * Calculate the value of the company. That is the value of all
- * assets (vehicles, stations) and money (including loan),
- * except when including_loan is \c false which is useful when
- * we want to calculate the value for bankruptcy.
+ * Calculate the value of the company from the already known value of its assets.
  * @param c the company to get the value of.
+ * @param asset_value the value of the stations and vehicles of the company.
  * @param including_loan include the loan in the company value.
  * @return the value of the company.
  */
-Money CalculateCompanyValue(const Company *c, bool including_loan)
+static Money CalculateCompanyValueFromAssets(const Company *c, Money asset_value, bool including_loan)
 {
-	Money value = CalculateCompanyAssetValue(c);
+	Money value = asset_value;
 
 	/* Add real money value */
 	if (including_loan) value -= c->current_loan;
@@ -161,6 +200,20 @@ Money CalculateCompanyValue(const Company *c, bool including_loan)
 	return std::max<Money>(value, 1);
 }
 
+/**
+ * Calculate the value of the company. That is the value of all
+ * assets (vehicles, stations) and money (including loan),
+ * except when including_loan is \c false which is useful when
+ * we want to calculate the value for bankruptcy.
+ * @param c the company to get the value of.
+ * @param including_loan include the loan in the company value.
+ * @return the value of the company.
+ */
+Money CalculateCompanyValue(const Company *c, bool including_loan)
+{
+	return CalculateCompanyValueFromAssets(c, CalculateCompanyAssetValue(c), including_loan);
+}
+
 /**
  * Calculate what you have to pay to take over a company.
  *
@@ -195,14 +248,13 @@ Money CalculateHostileTakeoverValue(const Company *c)
 }
 
 /**
- * if update is set to true, the economy is updated with this score
- *  (also the house is updated, should only be true in the on-tick event)
- * @param update the economy with calculated score
+ * Calculate the performance rating of a company from its already gathered asset totals.
  * @param c company been evaluated
+ * @param update the economy with calculated score
+ * @param stats the station and vehicle totals of the company
  * @return actual score of this company
- *
  */
-int UpdateCompanyRatingAndValue(Company *c, bool update)
+static int UpdateCompanyRatingAndValue(Company *c, bool update, const CompanyAssetStats &stats)
 {
 	Owner owner = c->index;
 	int score = 0;
@@ -211,27 +263,9 @@ int UpdateCompanyRatingAndValue(Company *c, bool update)
 
 	/* Count vehicles */
 	{
-		Money min_profit = 0;
-		bool min_profit_first = true;
-		uint num = 0;
-
-		for (const Vehicle *v : Vehicle::Iterate()) {
-			if (v->owner != owner) continue;
-			if (IsCompanyBuildableVehicleType(v->type) && v->IsPrimaryVehicle()) {
-				if (v->profit_last_year > 0) num++; // For the vehicle score only count profitable vehicles
-				if (v->economy_age > VEHICLE_PROFIT_MIN_AGE) {
-					/* Find the vehicle with the lowest amount of profit */
-					if (min_profit_first || min_profit > v->profit_last_year) {
-						min_profit = v->profit_last_year;
-						min_profit_first = false;
-					}
-				}
-			}
-		}
+		Money min_profit = stats.min_profit >> 8; // remove the fract part
 
-		min_profit >>= 8; // remove the fract part
-
-		_score_part[owner][SCORE_VEHICLES] = num;
+		_score_part[owner][SCORE_VEHICLES] = stats.profitable_vehicles;
 		/* Don't allow negative min_profit to show */
 		if (min_profit > 0) {
 			_score_part[owner][SCORE_MIN_PROFIT] = min_profit;
@@ -239,14 +273,7 @@ int UpdateCompanyRatingAndValue(Company *c, bool update)
 	}
 
 	/* Count stations */
-	{
-		uint num = 0;
-		for (const Station *st : Station::Iterate()) {
-			/* Only count stations that are actually serviced */
-			if (st->owner == owner && (st->time_since_load <= 20 || st->time_since_unload <= 20)) num += st->facilities.Count();
-		}
-		_score_part[owner][SCORE_STATIONS] = num;
-	}
+	_score_part[owner][SCORE_STATIONS] = stats.serviced_facilities;
 
 	/* Generate statistics depending on recent income statistics */
 	{
@@ -310,13 +337,28 @@ int UpdateCompanyRatingAndValue(Company *c, bool update)
 	if (update) {
 		c->old_economy[0].performance_history = score;
 		UpdateCompanyHQ(c->location_of_HQ, score);
-		c->old_economy[0].company_value = CalculateCompanyValue(c);
+		c->old_economy[0].company_value = CalculateCompanyValueFromAssets(c, stats.asset_value, true);
 	}
 
 	SetWindowDirty(WC_PERFORMANCE_DETAIL, 0);
 	return score;
 }
 
+/**
+ * if update is set to true, the economy is updated with this score
+ *  (also the house is updated, should only be true in the on-tick event)
+ * @param update the economy with calculated score
+ * @param c company been evaluated
+ * @return actual score of this company
+ *
+ */
+int UpdateCompanyRatingAndValue(Company *c, bool update)
+{
+	CompanyAssetStatsList stats;
+	GatherCompanyAssetStats(stats);
+	return UpdateCompanyRatingAndValue(c, update, stats[c->index]);
+}
+
 /**
  * Change the ownership of all the items of a company.
  * @param old_owner The company that gets removed.
@@ -681,6 +723,10 @@ static void CompaniesGenStatistics()
 	/* Only run the economic statistics and update company stats every 3rd economy month (1st of quarter). */
 	if (!HasBit(1 << 0 | 1 << 3 | 1 << 6 | 1 << 9, TimerGameEconomy::month)) return;
 
+	/* Gather the stations and vehicles of all companies in one go, instead of once per company. */
+	CompanyAssetStatsList asset_stats;
+	GatherCompanyAssetStats(asset_stats);
+
 	for (Company *c : Company::Iterate()) {
 		/* Drop the oldest history off the end */
 		std::copy_backward(c->old_economy.data(), c->old_economy.data() + MAX_HISTORY_QUARTERS - 1, c->old_economy.data() + MAX_HISTORY_QUARTERS);
@@ -689,7 +735,7 @@ static void CompaniesGenStatistics()
 
 		if (c->num_valid_stat_ent != MAX_HISTORY_QUARTERS) c->num_valid_stat_ent++;
 
-		UpdateCompanyRatingAndValue(c, true);
+		UpdateCompanyRatingAndValue(c, true, asset_stats[c->index]);
 		if (c->block_preview != 0) c->block_preview--;
 	}
 
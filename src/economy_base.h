@@ -12,8 +12,8 @@
 
 #include "cargopacket.h"
 
-/** Type of pool to store cargo payments in; little over 1 million. */
-using CargoPaymentPool = Pool<CargoPayment, CargoPaymentID, 512>;
+/** Type of pool to store cargo payments in; little over 1 million. Payments are created and freed on every (un)load, so reuse their memory. */
+using CargoPaymentPool = Pool<CargoPayment, CargoPaymentID, 512, PoolType::Normal, true>;
 /** The actual pool to store cargo payments in. */
 extern CargoPaymentPool _cargo_payment_pool;
 
@@ -298,6 +298,9 @@ static void DrawRailCatenaryRailway(const TileInfo *ti)
 
 	AdjustTileh(ti->tile, &tileh[TS_HOME]);
 
+	/* The bridge above does not change per tile edge, so look its height up once. */
+	int bridge_height = IsBridgeAbove(ti->tile) ? GetBridgeHeight(GetCachedBridgeEnds(ti->tile).first) : 0;
+
 	SpriteID pylon_normal = GetPylonBase(ti->tile);
 	SpriteID pylon_halftile = (halftile_corner != CORNER_INVALID) ? GetPylonBase(ti->tile, TCX_UPPER_HALFTILE) : pylon_normal;
 
@@ -399,9 +402,8 @@ static void DrawRailCatenaryRailway(const TileInfo *ti)
 
 		if (IsBridgeAbove(ti->tile)) {
 			Track bridgetrack = GetBridgeAxis(ti->tile) == AXIS_X ? TRACK_X : TRACK_Y;
-			int height = GetBridgeHeight(GetNorthernBridgeEnd(ti->tile));
 
-			if ((height <= GetTileMaxZ(ti->tile) + 1) &&
+			if ((bridge_height <= GetTileMaxZ(ti->tile) + 1) &&
 					(i == _pcp_positions[bridgetrack][0] || i == _pcp_positions[bridgetrack][1])) {
 				override_pcp.Set(i);
 			}
@@ -439,9 +441,7 @@ static void DrawRailCatenaryRailway(const TileInfo *ti)
 
 	/* Don't draw a wire under a low bridge */
 	if (IsBridgeAbove(ti->tile) && !IsTransparencySet(TO_BRIDGES)) {
-		int height = GetBridgeHeight(GetNorthernBridgeEnd(ti->tile));
-
-		if (height <= GetTileMaxZ(ti->tile) + 1) return;
+		if (bridge_height <= GetTileMaxZ(ti->tile) + 1) return;
 	}
 
 	/* Don't draw a wire if the station tile does not want any */
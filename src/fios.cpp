@@ -23,6 +23,7 @@
 #include <sys/stat.h>
 #include <charconv>
 #include <filesystem>
+#include <unordered_set>
 
 #include "table/strings.h"
 
@@ -239,6 +240,7 @@ class FiosFileScanner : public FileScanner {
 	SaveLoadOperation fop;   ///< The kind of file we are looking for.
 	FiosGetTypeAndNameProc *callback_proc; ///< Callback to check whether the file may be added
 	FileList &file_list;     ///< Destination of the found files.
+	std::unordered_set<std::string> names; ///< Names of the items in #file_list, to skip duplicates without a linear search.
 public:
 	/**
 	 * Create the scanner
@@ -248,7 +250,9 @@ public:
 	 */
 	FiosFileScanner(SaveLoadOperation fop, FiosGetTypeAndNameProc *callback_proc, FileList &file_list) :
 			fop(fop), callback_proc(callback_proc), file_list(file_list)
-	{}
+	{
+		for (const auto &fios : file_list) this->names.insert(fios.name);
+	}
 
 	bool AddFile(const std::string &filename, size_t basepath_length, const std::string &tar_filename) override;
 };
@@ -264,13 +268,13 @@ bool FiosFileScanner::AddFile(const std::string &filename, size_t, const std::st
 	if (sep == std::string::npos) return false;
 	std::string ext = filename.substr(sep);
 
+	/* Check for duplicates first, the callback may have to open the file. */
+	if (this->names.contains(filename)) return false;
+
 	auto [type, title] = this->callback_proc(this->fop, filename, ext);
 	if (type == FIOS_TYPE_INVALID) return false;
 
-	for (const auto &fios : file_list) {
-		if (filename == fios.name) return false;
-	}
-
+	this->names.insert(filename);
 	FiosItem *fios = &file_list.emplace_back();
 
 	std::error_code error_code;
@@ -53,8 +53,7 @@ TrueTypeFontCache::GlyphEntry *TrueTypeFontCache::GetGlyphPtr(GlyphID key)
 
 TrueTypeFontCache::GlyphEntry &TrueTypeFontCache::SetGlyphPtr(GlyphID key, GlyphEntry &&glyph)
 {
-	this->glyph_to_sprite_map[key] = std::move(glyph);
-	return this->glyph_to_sprite_map[key];
+	return this->glyph_to_sprite_map.insert_or_assign(key, std::move(glyph)).first->second;
 }
 
 bool TrueTypeFontCache::GetDrawGlyphShadow()
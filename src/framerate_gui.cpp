@@ -149,6 +149,36 @@ namespace {
 			return sumtime * 1000 / count / TIMESTAMP_PRECISION;
 		}
 
+		/**
+		 * Get cycle processing time percentiles over a number of data points
+		 * @param count Number of most recent data points to consider.
+		 * @param percentiles Percentiles to get, each in the range 0 to 100.
+		 * @return Durations in milliseconds for each of the percentiles, empty if there are no valid points.
+		 */
+		std::vector<double> GetDurationPercentilesMilliseconds(int count, std::initializer_list<int> percentiles)
+		{
+			count = std::min(count, this->num_valid);
+
+			int first_point = this->prev_index - count;
+			if (first_point < 0) first_point += NUM_FRAMERATE_POINTS;
+
+			std::vector<TimingMeasurement> valid;
+			valid.reserve(count);
+			for (int i = first_point; i < first_point + count; i++) {
+				auto d = this->durations[i % NUM_FRAMERATE_POINTS];
+				if (d != INVALID_DURATION) valid.push_back(d);
+			}
+
+			std::vector<double> result;
+			if (valid.empty()) return result;
+			for (int percentile : percentiles) {
+				auto nth = valid.begin() + (valid.size() - 1) * percentile / 100;
+				std::nth_element(valid.begin(), nth, valid.end());
+				result.push_back((double)*nth * 1000 / TIMESTAMP_PRECISION);
+			}
+			return result;
+		}
+
 		/** Get current rate of a performance element, based on approximately the past one second of data */
 		double GetRate()
 		{
@@ -1052,6 +1082,15 @@ void ConPrintFramerate()
 		printed_anything = true;
 	}
 
+	if (_pf_data[PFE_GAMELOOP].num_valid != 0) {
+		/* Averages hide the occasional slow tick, which is what players notice as lag. */
+		auto p = _pf_data[PFE_GAMELOOP].GetDurationPercentilesMilliseconds(count3, {50, 95, 99, 100});
+		if (!p.empty()) {
+			IConsolePrint(TC_LIGHT_BLUE, "{} time percentiles: p50 {:.2f}ms  p95 {:.2f}ms  p99 {:.2f}ms  max {:.2f}ms",
+				MEASUREMENT_NAMES[PFE_GAMELOOP], p[0], p[1], p[2], p[3]);
+		}
+	}
+
 	if (!printed_anything) {
 		IConsolePrint(CC_ERROR, "No performance measurements have been taken yet.");
 	}
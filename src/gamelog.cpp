@@ -77,12 +77,39 @@ void Gamelog::StopAction()
 
 	bool print = this->current_action != nullptr;
 
+	if (print && this->action_type == GLAT_SETTING) this->MergeSettingChange();
+
 	this->current_action = nullptr;
 	this->action_type = GLAT_NONE;
 
 	if (print) this->PrintDebug(5);
 }
 
+/**
+ * Merge the setting change that was just logged into the previous action, when
+ * that one changed the same setting. Changing a setting repeatedly, e.g. by a
+ * script or by trying out values, then keeps a single entry with the first old
+ * value and the last new value instead of growing the gamelog with every change.
+ */
+void Gamelog::MergeSettingChange()
+{
+	auto &actions = this->data->action;
+	if (actions.size() < 2) return;
+
+	LoggedAction &last = actions[actions.size() - 1];
+	LoggedAction &prev = actions[actions.size() - 2];
+	if (prev.at != GLAT_SETTING || prev.change.size() != 1 || last.change.size() != 1) return;
+	if (prev.change[0]->ct != GLCT_SETTING || last.change[0]->ct != GLCT_SETTING) return;
+
+	auto *prev_change = static_cast<LoggedChangeSettingChanged *>(prev.change[0].get());
+	const auto *last_change = static_cast<const LoggedChangeSettingChanged *>(last.change[0].get());
+	if (prev_change->name != last_change->name) return;
+
+	prev_change->newval = last_change->newval;
+	prev.tick = last.tick;
+	actions.pop_back();
+}
+
 void Gamelog::StopAnyAction()
 {
 	if (this->action_type != GLAT_NONE) this->StopAction();
@@ -53,6 +53,7 @@ private:
 	struct LoggedAction *current_action;
 
 	void Change(std::unique_ptr<LoggedChange> &&change);
+	void MergeSettingChange();
 
 public:
 	Gamelog();
@@ -713,9 +713,11 @@ protected:
 		/* If nothing is highlighted then no redraw is needed. */
 		if (this->highlight_data == UINT8_MAX && this->highlight_range == UINT8_MAX) return;
 
-		/* Toggle the highlight state and redraw. */
+		/* Toggle the highlight state and redraw only the widgets showing it. */
 		this->highlight_state = !this->highlight_state;
-		this->SetDirty();
+		this->SetWidgetDirty(WID_GRAPH_GRAPH);
+		if (this->highlight_range != UINT8_MAX) this->SetWidgetDirty(WID_GRAPH_RANGE_MATRIX);
+		if (this->highlight_data != UINT8_MAX) this->SetWidgetDirty(WID_GRAPH_MATRIX);
 	}};
 
 	void UpdateMatrixSize(WidgetID widget, Dimension &size, Dimension &resize, auto labels)
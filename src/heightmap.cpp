@@ -114,11 +114,15 @@ static void ReadHeightmapPNGImageData(std::span<uint8_t> map, png_structp png_pt
 	}
 
 	row_pointers = png_get_rows(png_ptr, info_ptr);
+	uint width = png_get_image_width(png_ptr, info_ptr);
+	uint height = png_get_image_height(png_ptr, info_ptr);
 
-	/* Read the raw image data and convert in 8-bit greyscale */
-	for (x = 0; x < png_get_image_width(png_ptr, info_ptr); x++) {
-		for (y = 0; y < png_get_image_height(png_ptr, info_ptr); y++) {
-			uint8_t *pixel = &map[y * png_get_image_width(png_ptr, info_ptr) + x];
+	/* Read the raw image data and convert in 8-bit greyscale.
+	 * Walk the image row by row, so both the decoded rows and the greyscale
+	 * map are read and written sequentially. */
+	for (y = 0; y < height; y++) {
+		for (x = 0; x < width; x++) {
+			uint8_t *pixel = &map[static_cast<size_t>(y) * width + x];
 			uint x_offset = x * channels;
 
 			if (has_palette) {
@@ -244,28 +244,29 @@ void GetCargoSuffix(CargoSuffixInOut use_input, CargoSuffixType cst, const Indus
 }
 
 std::array<IndustryType, NUM_INDUSTRYTYPES> _sorted_industry_types; ///< Industry types sorted by name.
-
-/** Sort industry types by their name. */
-static bool IndustryTypeNameSorter(const IndustryType &a, const IndustryType &b)
-{
-	int r = StrNaturalCompare(GetString(GetIndustrySpec(a)->name), GetString(GetIndustrySpec(b)->name)); // Sort by name (natural sorting).
-
-	/* If the names are equal, sort by industry type. */
-	return (r != 0) ? r < 0 : (a < b);
-}
+static std::array<uint8_t, NUM_INDUSTRYTYPES> _industry_type_sort_rank; ///< Position of each industry type in #_sorted_industry_types.
 
 /**
  * Initialize the list of sorted industry types.
  */
 void SortIndustryTypes()
 {
-	/* Add each industry type to the list. */
+	/* Format each name once instead of for every comparison. */
+	std::array<std::string, NUM_INDUSTRYTYPES> names;
 	for (IndustryType i = 0; i < NUM_INDUSTRYTYPES; i++) {
 		_sorted_industry_types[i] = i;
+		names[i] = GetString(GetIndustrySpec(i)->name);
 	}
 
-	/* Sort industry types by name. */
-	std::sort(_sorted_industry_types.begin(), _sorted_industry_types.end(), IndustryTypeNameSorter);
+	/* Sort industry types by name. If the names are equal, sort by industry type. */
+	std::sort(_sorted_industry_types.begin(), _sorted_industry_types.end(), [&names](IndustryType a, IndustryType b) {
+		int r = StrNaturalCompare(names[a], names[b]); // Sort by name (natural sorting).
+		return (r != 0) ? r < 0 : (a < b);
+	});
+
+	for (uint i = 0; i < NUM_INDUSTRYTYPES; i++) {
+		_industry_type_sort_rank[_sorted_industry_types[i]] = i;
+	}
 }
 
 static constexpr std::initializer_list<NWidgetPart> _nested_build_industry_widgets = {
@@ -1606,11 +1607,7 @@ protected:
 	/** Sort industries by type and name */
 	static bool IndustryTypeSorter(const Industry * const &a, const Industry * const &b, const CargoType &filter)
 	{
-		int it_a = 0;
-		while (it_a != NUM_INDUSTRYTYPES && a->type != _sorted_industry_types[it_a]) it_a++;
-		int it_b = 0;
-		while (it_b != NUM_INDUSTRYTYPES && b->type != _sorted_industry_types[it_b]) it_b++;
-		int r = it_a - it_b;
+		int r = _industry_type_sort_rank[a->type] - _industry_type_sort_rank[b->type];
 		return (r == 0) ? IndustryNameSorter(a, b, filter) : r < 0;
 	}
 
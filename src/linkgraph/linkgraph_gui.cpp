@@ -74,11 +74,21 @@ void LinkGraphOverlay::RebuildCache()
 {
 	this->cached_links.clear();
 	this->cached_stations.clear();
+	this->cached_middles.clear();
 	if (this->company_mask.None()) return;
 
 	DrawPixelInfo dpi;
 	this->GetWidgetDpi(&dpi);
 
+	/* Finding the height of a station is relatively expensive, and the middles are
+	 * needed for every link on every redraw, so keep them until the next rebuild. */
+	if (this->window->viewport != nullptr) {
+		this->cached_middles.resize(Station::GetPoolSize());
+		for (const Station *st : Station::Iterate()) {
+			this->cached_middles[st->index.base()] = GetStationVirtualMiddle(st);
+		}
+	}
+
 	for (const Station *sta : Station::Iterate()) {
 		if (sta->rect.IsEmpty()) continue;
 
@@ -416,6 +426,7 @@ bool LinkGraphOverlay::ShowTooltip(Point pt, TooltipCloseCondition close_cond)
 Point LinkGraphOverlay::GetStationMiddle(const Station *st) const
 {
 	if (this->window->viewport != nullptr) {
+		if (st->index.base() < this->cached_middles.size()) return GetViewportStationMiddle(*this->window->viewport, this->cached_middles[st->index.base()]);
 		return GetViewportStationMiddle(*this->window->viewport, st);
 	} else {
 		/* assume this is a smallmap */
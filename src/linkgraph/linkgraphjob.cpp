@@ -53,31 +53,28 @@ void LinkGraphJob::EraseFlows(StationID from)
 }
 
 /**
- * Spawn a thread if possible and run the link graph job in the thread. If
- * that's not possible run the job right now in the current thread.
+ * Queue the link graph job in the link graph worker pool. If the pool has
+ * no threads the job is run right now in the current thread.
  */
 void LinkGraphJob::SpawnThread()
 {
-	if (!StartNewThread(&this->thread, "ottd:linkgraph", &(LinkGraphSchedule::Run), this)) {
-		/* Of course this will hang a bit.
-		 * On the other hand, if you want to play games which make this hang noticeably
-		 * on a platform without threads then you'll probably get other problems first.
-		 * OK:
-		 * If someone comes and tells me that this hangs for them, I'll implement a
-		 * smaller grained "Step" method for all handlers and add some more ticks where
-		 * "Step" is called. No problem in principle. */
-		LinkGraphSchedule::Run(this);
-	}
+	/* Of course this will hang a bit if there are no threads.
+	 * On the other hand, if you want to play games which make this hang noticeably
+	 * on a platform without threads then you'll probably get other problems first.
+	 * OK:
+	 * If someone comes and tells me that this hangs for them, I'll implement a
+	 * smaller grained "Step" method for all handlers and add some more ticks where
+	 * "Step" is called. No problem in principle. */
+	this->task = LinkGraphSchedule::instance.GetWorkerPool().Submit([this]() { LinkGraphSchedule::Run(this); });
 }
 
 /**
- * Join the calling thread with this job's thread if threading is enabled.
+ * Wait for this job's task to finish if it has been spawned.
  */
 void LinkGraphJob::JoinThread()
 {
-	if (this->thread.joinable()) {
-		this->thread.join();
-	}
+	/* get() rethrows any exception of the job and leaves the future invalid. */
+	if (this->task.valid()) this->task.get();
 }
 
 /**
@@ -182,9 +179,20 @@ LinkGraphJob::~LinkGraphJob()
 void LinkGraphJob::Init()
 {
 	uint size = this->Size();
+	size_t num_edges = 0;
+	for (uint i = 0; i < size; ++i) num_edges += this->link_graph.nodes[i].edges.size();
+
+	/* Reserve everything up front; the nodes keep spans into these vectors. */
+	this->edges.reserve(num_edges);
+	this->demands.resize(static_cast<size_t>(size) * size);
 	this->nodes.reserve(size);
 	for (uint i = 0; i < size; ++i) {
-		this->nodes.emplace_back(this->link_graph.nodes[i], this->link_graph.Size());
+		const LinkGraph::BaseNode &node = this->link_graph.nodes[i];
+		size_t first = this->edges.size();
+		for (const auto &e : node.edges) this->edges.emplace_back(e);
+		this->nodes.emplace_back(node,
+				std::span<EdgeAnnotation>(this->edges.data() + first, node.edges.size()),
+				std::span<DemandAnnotation>(this->demands.data() + static_cast<size_t>(i) * size, size));
 	}
 }
 
@@ -11,8 +11,10 @@
 #define LINKGRAPHJOB_H
 
 #include "../thread.h"
+#include <future>
 #include "linkgraph.h"
 #include <atomic>
+#include <span>
 
 class LinkGraphJob;
 class Path;
@@ -75,6 +77,8 @@ public:
 
 	/**
 	 * Annotation for a link graph node.
+	 * Edge and demand annotations of all nodes are stored contiguously in the job
+	 * (compressed sparse row layout), the node only refers to its own part of them.
 	 */
 	struct NodeAnnotation {
 		const LinkGraph::BaseNode &base; ///< Reference to the node that is annotated.
@@ -83,37 +87,22 @@ public:
 		PathList paths{}; ///< Paths through this node, sorted so that those with flow == 0 are in the back.
 		FlowStatMap flows{}; ///< Planned flows to other nodes.
 
-		std::vector<EdgeAnnotation> edges{}; ///< Annotations for all edges originating at this node.
-		std::vector<DemandAnnotation> demands{}; ///< Annotations for the demand to all other nodes.
+		std::span<EdgeAnnotation> edges{}; ///< Annotations for all edges originating at this node, sorted by destination.
+		std::span<DemandAnnotation> demands{}; ///< Annotations for the demand to all other nodes.
 
-		NodeAnnotation(const LinkGraph::BaseNode &node, size_t size) : base(node), undelivered_supply(node.supply)
-		{
-			this->edges.reserve(node.edges.size());
-			for (auto &e : node.edges) this->edges.emplace_back(e);
-			this->demands.resize(size);
-		}
-
-		/**
-		 * Retrieve an edge starting at this node.
-		 * @param to Remote end of the edge.
-		 * @return Edge between this node and "to".
-		 */
-		EdgeAnnotation &operator[](NodeID to)
-		{
-			auto it = std::ranges::find_if(this->edges, [=] (const EdgeAnnotation &e) { return e.base.dest_node == to; });
-			assert(it != this->edges.end());
-			return *it;
-		}
+		NodeAnnotation(const LinkGraph::BaseNode &node, std::span<EdgeAnnotation> edges, std::span<DemandAnnotation> demands) :
+			base(node), undelivered_supply(node.supply), edges(edges), demands(demands) {}
 
 		/**
 		 * Retrieve an edge starting at this node.
 		 * @param to Remote end of the edge.
 		 * @return Edge between this node and "to".
 		 */
-		const EdgeAnnotation &operator[](NodeID to) const
+		EdgeAnnotation &operator[](NodeID to) const
 		{
-			auto it = std::ranges::find_if(this->edges, [=] (const EdgeAnnotation &e) { return e.base.dest_node == to; });
-			assert(it != this->edges.end());
+			auto it = std::lower_bound(this->edges.begin(), this->edges.end(), to,
+					[] (const EdgeAnnotation &e, NodeID to) { return e.base.dest_node < to; });
+			assert(it != this->edges.end() && it->base.dest_node == to);
 			return *it;
 		}
 
@@ -161,9 +150,11 @@ private:
 protected:
 	const LinkGraph link_graph; ///< Link graph to by analyzed. Is copied when job is started and mustn't be modified later.
 	const LinkGraphSettings settings; ///< Copy of _settings_game.linkgraph at spawn time.
-	std::thread thread{}; ///< Thread the job is running in or a default-constructed thread if it's running in the main thread.
+	std::future<void> task{}; ///< Task of the job in the worker pool, invalid if it's not been spawned yet.
 	TimerGameEconomy::Date join_date = EconomyTime::INVALID_DATE; ///< Date when the job is to be joined.
 	NodeAnnotationVector nodes{}; ///< Extra node data necessary for link graph calculation.
+	std::vector<EdgeAnnotation> edges{}; ///< Edge annotations of all nodes, grouped by source node.
+	std::vector<DemandAnnotation> demands{}; ///< Demand annotations between all pairs of nodes, Size() per source node.
 	std::atomic<bool> job_completed = false; ///< Is the job still running. This is accessed by multiple threads and reads may be stale.
 	std::atomic<bool> job_aborted = false; ///< Has the job been aborted. This is accessed by multiple threads and reads may be stale.
 
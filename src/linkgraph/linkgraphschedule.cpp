@@ -17,6 +17,7 @@
 #include "../command_func.h"
 #include "../network/network.h"
 #include "../misc_cmd.h"
+#include "../settings_type.h"
 
 #include "../safeguards.h"
 
@@ -104,6 +105,19 @@ void LinkGraphSchedule::JoinNext()
 	job->job_completed.store(true, std::memory_order_release);
 }
 
+/**
+ * Get the pool running the link graph jobs, starting its workers on first use.
+ * @return The worker pool.
+ */
+WorkerPool &LinkGraphSchedule::GetWorkerPool()
+{
+	if (!this->workers.IsRunning()) {
+		uint threads = _settings_client.gui.cm_linkgraph_threads;
+		this->workers.Start(threads != 0 ? threads : WorkerPool::GetDefaultWorkerCount());
+	}
+	return this->workers;
+}
+
 /**
  * Start all threads in the running list. This is only useful for save/load.
  * Usually threads are started when the job is created.
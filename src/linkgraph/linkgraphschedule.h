@@ -11,6 +11,7 @@
 #define LINKGRAPHSCHEDULE_H
 
 #include "linkgraph.h"
+#include "../worker_pool.h"
 
 class LinkGraphJob;
 
@@ -42,6 +43,7 @@ private:
 	friend SaveLoadTable GetLinkGraphScheduleDesc();
 
 protected:
+	WorkerPool workers{"ottd:linkgraph"}; ///< Threads the jobs are run on. Declared first so it outlives the jobs.
 	std::array<std::unique_ptr<ComponentHandler>, 6> handlers{}; ///< Handlers to be run for each job.
 	GraphList schedule;            ///< Queue for new jobs.
 	JobList running;               ///< Currently running jobs.
@@ -59,6 +61,7 @@ public:
 	void JoinNext();
 	void SpawnAll();
 	void ShiftDates(TimerGameEconomy::Date interval);
+	WorkerPool &GetWorkerPool();
 
 	/**
 	 * Queue a link graph for execution.
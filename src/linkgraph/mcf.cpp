@@ -95,8 +95,8 @@ class GraphEdgeIterator {
 private:
 	LinkGraphJob &job; ///< Job being executed
 
-	std::vector<LinkGraphJob::EdgeAnnotation>::const_iterator i;   ///< Iterator pointing to current edge.
-	std::vector<LinkGraphJob::EdgeAnnotation>::const_iterator end; ///< Iterator pointing beyond last edge.
+	std::span<LinkGraphJob::EdgeAnnotation>::iterator i;   ///< Iterator pointing to current edge.
+	std::span<LinkGraphJob::EdgeAnnotation>::iterator end; ///< Iterator pointing beyond last edge.
 
 public:
 
@@ -112,8 +112,8 @@ public:
 	 */
 	void SetNode(NodeID, NodeID node)
 	{
-		this->i = this->job[node].edges.cbegin();
-		this->end = this->job[node].edges.cend();
+		this->i = this->job[node].edges.begin();
+		this->end = this->job[node].edges.end();
 	}
 
 	/**
@@ -260,6 +260,12 @@ void MultiCommodityFlow::Dijkstra(NodeID source_node, PathVector &paths)
 	Tedge_iterator iter(this->job);
 	uint16_t size = this->job.Size();
 	AnnoSet annos;
+	/* Prioritize the fastest route for passengers, mail and express cargo,
+	 * and the shortest route for other classes of cargo.
+	 * In-between stops are punished with a 1 tile or 1 day penalty. */
+	bool express = IsCargoInClass(this->job.Cargo(), CargoClass::Passengers) ||
+		IsCargoInClass(this->job.Cargo(), CargoClass::Mail) ||
+		IsCargoInClass(this->job.Cargo(), CargoClass::Express);
 	paths.resize(size, nullptr);
 	for (NodeID node = 0; node < size; ++node) {
 		Tannotation *anno = new Tannotation(node, node == source_node);
@@ -282,12 +288,6 @@ void MultiCommodityFlow::Dijkstra(NodeID source_node, PathVector &paths)
 				capacity /= 100;
 				if (capacity == 0) capacity = 1;
 			}
-			/* Prioritize the fastest route for passengers, mail and express cargo,
-			 * and the shortest route for other classes of cargo.
-			 * In-between stops are punished with a 1 tile or 1 day penalty. */
-			bool express = IsCargoInClass(this->job.Cargo(), CargoClass::Passengers) ||
-				IsCargoInClass(this->job.Cargo(), CargoClass::Mail) ||
-				IsCargoInClass(this->job.Cargo(), CargoClass::Express);
 			uint distance = DistanceMaxPlusManhattan(this->job[from].base.xy, this->job[to].base.xy) + 1;
 			/* Compute a default travel time from the distance and an average speed of 1 tile/day. */
 			uint time = (edge.base.TravelTime() != 0) ? edge.base.TravelTime() + Ticks::DAY_TICKS : distance * Ticks::DAY_TICKS;
@@ -13,8 +13,13 @@
 #include "error_func.h"
 #include "string_func.h"
 #include "pathfinder/water_regions.h"
+#include "vehicle_func.h"
 #include "citymania/cm_highlight.hpp"
 
+#if defined(__linux__)
+#	include <sys/mman.h>
+#endif
+
 #include "safeguards.h"
 
 /* static */ uint Map::log_x;     ///< 2^_map_log_x == _map_size_x
@@ -28,8 +33,33 @@
 
 /* static */ std::unique_ptr<Tile::TileBase[]> Tile::base_tiles; ///< Base tiles of the map
 /* static */ std::unique_ptr<Tile::TileExtended[]> Tile::extended_tiles; ///< Extended tiles of the map
+#ifdef WITH_BLOCKED_TILE_LAYOUT
+/* static */ uint Tile::storage_log_x; ///< Copy of Map::log_x for Tile::StorageIndex
+#endif
 
 
+/**
+ * Ask the kernel to back a large array with transparent huge pages.
+ * Tile access during tile loops, pathfinding and drawing is fairly random, so
+ * on big maps fewer and larger pages save a lot of TLB misses.
+ * Only the 2 MiB aligned part of the array can be advised; this is a hint and
+ * failing to apply it is harmless.
+ * @param data Start of the array.
+ * @param bytes Size of the array in bytes.
+ */
+static void AdviseHugePages([[maybe_unused]] void *data, [[maybe_unused]] size_t bytes)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	static const uintptr_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+	uintptr_t begin = Align(reinterpret_cast<uintptr_t>(data), HUGE_PAGE_SIZE);
+	uintptr_t end = (reinterpret_cast<uintptr_t>(data) + bytes) & ~(HUGE_PAGE_SIZE - 1);
+	if (end <= begin) return;
+	if (madvise(reinterpret_cast<void *>(begin), end - begin, MADV_HUGEPAGE) != 0) {
+		Debug(map, 3, "Could not advise huge pages for map array: {}", std::strerror(errno));
+	}
+#endif
+}
+
 /**
  * (Re)allocates a map with the given dimension
  * @param size_x the width of the map along the NE/SW edge
@@ -54,11 +84,20 @@
 	Map::size_y = size_y;
 	Map::size = size_x * size_y;
 	Map::tile_mask = Map::size - 1;
+#ifdef WITH_BLOCKED_TILE_LAYOUT
+	Tile::storage_log_x = Map::log_x;
+#endif
 
-	Tile::base_tiles = std::make_unique<Tile::TileBase[]>(Map::size);
-	Tile::extended_tiles = std::make_unique<Tile::TileExtended[]>(Map::size);
+	/* Advise huge pages before the arrays are first written, so the pages can be faulted in as huge pages right away. */
+	Tile::base_tiles = std::make_unique_for_overwrite<Tile::TileBase[]>(Map::size);
+	Tile::extended_tiles = std::make_unique_for_overwrite<Tile::TileExtended[]>(Map::size);
+	AdviseHugePages(Tile::base_tiles.get(), Map::size * sizeof(Tile::TileBase));
+	AdviseHugePages(Tile::extended_tiles.get(), Map::size * sizeof(Tile::TileExtended));
+	std::fill_n(Tile::base_tiles.get(), Map::size, Tile::TileBase{});
+	std::fill_n(Tile::extended_tiles.get(), Map::size, Tile::TileExtended{});
 
 	AllocateWaterRegions();
+	AllocateVehicleTileHash();
 	citymania::AllocateZoningMap(Map::size);
 }
 
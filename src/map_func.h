@@ -30,13 +30,13 @@ private:
 	 * Look at docs/landscape.html for the exact meaning of the members.
 	 */
 	struct TileBase {
-		uint8_t type = 0; ///< The type (bits 4..7), bridges (2..3), rainforest/desert (0..1)
-		uint8_t height = 0; ///< The height of the northern corner.
-		uint16_t m2 = 0; ///< Primarily used for indices to towns, industries and stations
-		uint8_t m1 = 0; ///< Primarily used for ownership information
-		uint8_t m3 = 0; ///< General purpose
-		uint8_t m4 = 0; ///< General purpose
-		uint8_t m5 = 0; ///< General purpose
+		uint8_t type; ///< The type (bits 4..7), bridges (2..3), rainforest/desert (0..1)
+		uint8_t height; ///< The height of the northern corner.
+		uint16_t m2; ///< Primarily used for indices to towns, industries and stations
+		uint8_t m1; ///< Primarily used for ownership information
+		uint8_t m3; ///< General purpose
+		uint8_t m4; ///< General purpose
+		uint8_t m5; ///< General purpose
 	};
 
 	static_assert(sizeof(TileBase) == 8);
@@ -46,16 +46,43 @@ private:
 	 * Look at docs/landscape.html for the exact meaning of the members.
 	 */
 	struct TileExtended {
-		uint8_t m6 = 0; ///< General purpose
-		uint8_t m7 = 0; ///< Primarily used for newgrf support
-		uint16_t m8 = 0; ///< General purpose
+		uint8_t m6; ///< General purpose
+		uint8_t m7; ///< Primarily used for newgrf support
+		uint16_t m8; ///< General purpose
 	};
 
+	/* Map::Allocate relies on this to allocate the arrays without touching them, and zero-fills them itself. */
+	static_assert(std::is_trivially_default_constructible_v<TileBase> && std::is_trivially_default_constructible_v<TileExtended>);
+
 	static std::unique_ptr<TileBase[]> base_tiles; ///< Pointer to the tile-array.
 	static std::unique_ptr<TileExtended[]> extended_tiles; ///< Pointer to the extended tile-array.
 
+#ifdef WITH_BLOCKED_TILE_LAYOUT
+	static uint storage_log_x; ///< Copy of Map::LogX() for #StorageIndex, as Map is not yet complete here.
+#endif
+
 	TileIndex tile; ///< The tile to access the map data for.
 
+	/**
+	 * Get the position of this tile's data in the tile arrays.
+	 * By default tiles are stored row by row, so this is just the tile index.
+	 * With WITH_BLOCKED_TILE_LAYOUT the map is stored in blocks of 8x8 tiles,
+	 * so a y-neighbour usually lives in the same or an adjacent cache line
+	 * instead of MapSizeX tiles further on. TileIndex itself stays row-major,
+	 * so only the storage order changes; savegames are unaffected.
+	 * @return Index into #base_tiles and #extended_tiles.
+	 */
+	[[debug_inline]] inline uint StorageIndex() const
+	{
+#ifdef WITH_BLOCKED_TILE_LAYOUT
+		uint x = this->tile.base() & ((1U << storage_log_x) - 1);
+		uint y = this->tile.base() >> storage_log_x;
+		return (((y >> 3) << (storage_log_x - 3)) | (x >> 3)) << 6 | (y & 7) << 3 | (x & 7);
+#else
+		return this->tile.base();
+#endif
+	}
+
 public:
 	/**
 	 * Create the tile wrapper for the given tile.
@@ -79,6 +106,18 @@ public:
 	 */
 	[[debug_inline]] inline constexpr operator uint() const { return this->tile.base(); }
 
+	/**
+	 * Hint the CPU to start loading the map data of this tile into the cache.
+	 * Useful when tiles are visited in a non-linear but known order.
+	 */
+	inline void Prefetch() const
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(&base_tiles[this->StorageIndex()]);
+		__builtin_prefetch(&extended_tiles[this->StorageIndex()]);
+#endif
+	}
+
 	/**
 	 * The type (bits 4..7), bridges (2..3), rainforest/desert (0..1)
 	 *
@@ -88,7 +127,7 @@ public:
 	 */
 	[[debug_inline]] inline uint8_t &type()
 	{
-		return base_tiles[this->tile.base()].type;
+		return base_tiles[this->StorageIndex()].type;
 	}
 
 	/**
@@ -100,7 +139,7 @@ public:
 	 */
 	[[debug_inline]] inline uint8_t &height()
 	{
-		return base_tiles[this->tile.base()].height;
+		return base_tiles[this->StorageIndex()].height;
 	}
 
 	/**
@@ -112,7 +151,7 @@ public:
 	 */
 	[[debug_inline]] inline uint8_t &m1()
 	{
-		return base_tiles[this->tile.base()].m1;
+		return base_tiles[this->StorageIndex()].m1;
 	}
 
 	/**
@@ -124,7 +163,7 @@ public:
 	 */
 	[[debug_inline]] inline uint16_t &m2()
 	{
-		return base_tiles[this->tile.base()].m2;
+		return base_tiles[this->StorageIndex()].m2;
 	}
 
 	/**
@@ -136,7 +175,7 @@ public:
 	 */
 	[[debug_inline]] inline uint8_t &m3()
 	{
-		return base_tiles[this->tile.base()].m3;
+		return base_tiles[this->StorageIndex()].m3;
 	}
 
 	/**
@@ -148,7 +187,7 @@ public:
 	 */
 	[[debug_inline]] inline uint8_t &m4()
 	{
-		return base_tiles[this->tile.base()].m4;
+		return base_tiles[this->StorageIndex()].m4;
 	}
 
 	/**
@@ -160,7 +199,7 @@ public:
 	 */
 	[[debug_inline]] inline uint8_t &m5()
 	{
-		return base_tiles[this->tile.base()].m5;
+		return base_tiles[this->StorageIndex()].m5;
 	}
 
 	/**
@@ -172,7 +211,7 @@ public:
 	 */
 	[[debug_inline]] inline uint8_t &m6()
 	{
-		return extended_tiles[this->tile.base()].m6;
+		return extended_tiles[this->StorageIndex()].m6;
 	}
 
 	/**
@@ -184,7 +223,7 @@ public:
 	 */
 	[[debug_inline]] inline uint8_t &m7()
 	{
-		return extended_tiles[this->tile.base()].m7;
+		return extended_tiles[this->StorageIndex()].m7;
 	}
 
 	/**
@@ -196,7 +235,7 @@ public:
 	 */
 	[[debug_inline]] inline uint16_t &m8()
 	{
-		return extended_tiles[this->tile.base()].m8;
+		return extended_tiles[this->StorageIndex()].m8;
 	}
 };
 
@@ -368,6 +407,15 @@ public:
 		return Tile::base_tiles != nullptr;
 	}
 
+	/**
+	 * Get the memory used by the tile arrays.
+	 * @return The size of the tile arrays in bytes.
+	 */
+	static size_t GetTileArraysSize()
+	{
+		return static_cast<size_t>(Map::Size()) * (sizeof(Tile::TileBase) + sizeof(Tile::TileExtended));
+	}
+
 	/**
 	 * Returns an iterable ensemble of all Tiles
 	 * @return an iterable ensemble of all Tiles
@@ -177,6 +177,62 @@ bool SetReusePort(SOCKET d)
 #endif
 }
 
+/**
+ * Check the readiness of the given sockets, without blocking.
+ * Unlike select() this has no FD_SETSIZE limit on the socket numbers and
+ * only costs time for the sockets that are actually passed.
+ * @param fds The sockets and the events to check for; revents gets filled in.
+ * @return The number of sockets that are ready, or -1 upon errors.
+ */
+int PollSockets(std::span<pollfd> fds)
+{
+#if defined(_WIN32)
+	return WSAPoll(fds.data(), static_cast<ULONG>(fds.size()), 0);
+#else
+	return poll(fds.data(), static_cast<nfds_t>(fds.size()), 0);
+#endif
+}
+
+/**
+ * Send several buffers, in order, with a single system call where the platform supports it.
+ * @param d The socket to send on.
+ * @param buffers The buffers to send; at most #SEND_GATHER_MAX_BUFFERS.
+ * @return The number of bytes sent, or -1 upon errors.
+ */
+ssize_t SendGathered(SOCKET d, std::span<const std::span<const uint8_t>> buffers)
+{
+	assert(!buffers.empty() && buffers.size() <= SEND_GATHER_MAX_BUFFERS);
+
+#if defined(_WIN32)
+	std::array<WSABUF, SEND_GATHER_MAX_BUFFERS> wsa_buffers;
+	for (size_t i = 0; i < buffers.size(); i++) {
+		wsa_buffers[i].buf = const_cast<char *>(reinterpret_cast<const char *>(buffers[i].data()));
+		wsa_buffers[i].len = static_cast<ULONG>(buffers[i].size());
+	}
+	DWORD sent = 0;
+	if (WSASend(d, wsa_buffers.data(), static_cast<DWORD>(buffers.size()), &sent, 0, nullptr, nullptr) != 0) return -1;
+	return sent;
+#elif defined(__EMSCRIPTEN__)
+	/* The websocket emulation only implements plain send(), so send the buffers one by one. */
+	ssize_t sent = 0;
+	for (std::span<const uint8_t> buffer : buffers) {
+		ssize_t res = send(d, buffer.data(), buffer.size(), 0);
+		/* Report an error only when nothing was sent; it will come up again on the next call. */
+		if (res <= 0) return sent > 0 ? sent : res;
+		sent += res;
+		if (static_cast<size_t>(res) < buffer.size()) break;
+	}
+	return sent;
+#else
+	std::array<iovec, SEND_GATHER_MAX_BUFFERS> iov;
+	for (size_t i = 0; i < buffers.size(); i++) {
+		iov[i].iov_base = const_cast<uint8_t *>(buffers[i].data());
+		iov[i].iov_len = buffers[i].size();
+	}
+	return writev(d, iov.data(), static_cast<int>(buffers.size()));
+#endif
+}
+
 /**
  * Get the error from a socket, if any.
  * @param d The socket to get the error from.
@@ -89,6 +89,8 @@ typedef unsigned long in_addr_t;
 
 #	include <errno.h>
 #	include <sys/time.h>
+#	include <sys/uio.h>
+#	include <poll.h>
 #	include <netdb.h>
 
 #   if defined(__EMSCRIPTEN__)
@@ -137,6 +139,11 @@ bool SetNoDelay(SOCKET d);
 bool SetReusePort(SOCKET d);
 NetworkError GetSocketError(SOCKET d);
 
+int PollSockets(std::span<pollfd> fds);
+
+static const size_t SEND_GATHER_MAX_BUFFERS = 16; ///< Maximum number of buffers passed to a single #SendGathered call.
+ssize_t SendGathered(SOCKET d, std::span<const std::span<const uint8_t>> buffers);
+
 /* Make sure these structures have the size we expect them to be */
 static_assert(sizeof(in_addr)  ==  4); ///< IPv4 addresses should be 4 bytes.
 static_assert(sizeof(in6_addr) == 16); ///< IPv6 addresses should be 16 bytes.
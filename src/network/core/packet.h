@@ -91,6 +91,15 @@ public:
 
 	size_t RemainingBytesToTransfer() const;
 
+	/**
+	 * Get the bytes that still need to be transferred out, without marking them as transferred.
+	 * @return The part of the packet after the position the last transfer stopped.
+	 */
+	std::span<const uint8_t> GetBytesToTransfer() const
+	{
+		return std::span<const uint8_t>(this->buffer.data() + this->pos, this->RemainingBytesToTransfer());
+	}
+
 	/**
 	 * Transfer data from the packet to the given function. It starts reading at the
 	 * position the last transfer stopped.
@@ -80,8 +80,18 @@ SendPacketsState NetworkTCPSocketHandler::SendPackets(bool closing_down)
 	if (!this->IsConnected()) return SPS_CLOSED;
 
 	while (!this->packet_queue.empty()) {
-		Packet &p = *this->packet_queue.front();
-		ssize_t res = p.TransferOut(SocketSender{this->sock});
+		/* Hand as many queued packets as possible to the OS in one go; with many
+		 * small frame and command packets this saves a system call per packet. */
+		std::array<std::span<const uint8_t>, SEND_GATHER_MAX_BUFFERS> buffers;
+		size_t count = 0;
+		size_t total = 0;
+		for (auto it = this->packet_queue.begin(); it != this->packet_queue.end() && count < buffers.size(); ++it) {
+			buffers[count] = (*it)->GetBytesToTransfer();
+			total += buffers[count].size();
+			count++;
+		}
+
+		ssize_t res = SendGathered(this->sock, std::span(buffers.data(), count));
 		if (res == -1) {
 			NetworkError err = NetworkError::GetLast();
 			if (!err.WouldBlock()) {
@@ -100,13 +110,18 @@ SendPacketsState NetworkTCPSocketHandler::SendPackets(bool closing_down)
 			return SPS_CLOSED;
 		}
 
-		/* Is this packet sent? */
-		if (p.RemainingBytesToTransfer() == 0) {
-			/* Go to the next packet */
-			this->packet_queue.pop_front();
-		} else {
-			return SPS_PARTLY_SENT;
+		/* Mark what was sent as transferred and drop the packets that are done. */
+		size_t sent = res;
+		while (sent > 0) {
+			Packet &p = *this->packet_queue.front();
+			size_t amount = std::min(sent, p.RemainingBytesToTransfer());
+			p.TransferOutWithLimit([](std::span<const uint8_t> buffer) { return static_cast<ssize_t>(buffer.size()); }, amount);
+			sent -= amount;
+			if (p.RemainingBytesToTransfer() == 0) this->packet_queue.pop_front();
 		}
+
+		/* The OS did not take everything; its buffer is full. */
+		if (static_cast<size_t>(res) < total) return SPS_PARTLY_SENT;
 	}
 
 	return SPS_ALL_SENT;
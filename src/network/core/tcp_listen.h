@@ -101,35 +101,38 @@ public:
 	 */
 	static bool Receive()
 	{
-		fd_set read_fd, write_fd;
-		struct timeval tv;
-
-		FD_ZERO(&read_fd);
-		FD_ZERO(&write_fd);
-
-
-		for (Tsocket *cs : Tsocket::Iterate()) {
-			FD_SET(cs->sock, &read_fd);
-			FD_SET(cs->sock, &write_fd);
-		}
+		/* Reused between calls; the socket numbers and pool indices of all polled sockets. */
+		static std::vector<pollfd> fds;
+		static std::vector<size_t> clients;
+		fds.clear();
+		clients.clear();
 
 		/* take care of listener port */
 		for (auto &s : sockets) {
-			FD_SET(s.first, &read_fd);
+			fds.push_back({s.first, POLLIN, 0});
 		}
+		const size_t first_client = fds.size();
 
-		tv.tv_sec = tv.tv_usec = 0; // don't block at all.
-		if (select(FD_SETSIZE, &read_fd, &write_fd, nullptr, &tv) < 0) return false;
+		for (Tsocket *cs : Tsocket::Iterate()) {
+			fds.push_back({cs->sock, POLLIN | POLLOUT, 0});
+			clients.push_back(cs->index.base());
+		}
+
+		if (PollSockets(fds) < 0) return false;
 
 		/* accept clients.. */
-		for (auto &s : sockets) {
-			if (FD_ISSET(s.first, &read_fd)) AcceptClient(s.first);
+		for (size_t i = 0; i < first_client; i++) {
+			if ((fds[i].revents & POLLIN) != 0) AcceptClient(fds[i].fd);
 		}
 
-		/* read stuff from clients */
-		for (Tsocket *cs : Tsocket::Iterate()) {
-			cs->writable = !!FD_ISSET(cs->sock, &write_fd);
-			if (FD_ISSET(cs->sock, &read_fd)) {
+		/* read stuff from clients; clients that were closed while handling another one are skipped */
+		for (size_t i = 0; i < clients.size(); i++) {
+			const pollfd &fd = fds[first_client + i];
+			Tsocket *cs = Tsocket::GetIfValid(clients[i]);
+			if (cs == nullptr || cs->sock != fd.fd) continue;
+
+			cs->writable = (fd.revents & POLLOUT) != 0;
+			if ((fd.revents & (POLLIN | POLLHUP | POLLERR)) != 0) {
 				cs->ReceivePackets();
 			}
 		}
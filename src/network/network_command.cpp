@@ -225,8 +225,9 @@ void NetworkSendCommand(Commands cmd, StringID err_message, CommandCallback *cal
 		c.frame = _frame_counter_max + 1;
 		c.my_cmd = true;
 
-		_local_wait_queue.push_back(std::move(c));
+		/* Register the callback while the packet still owns its data, it is hashed to match it up on execution. */
 		citymania::AddCommandCallback(&c);
+		_local_wait_queue.push_back(std::move(c));
 		return;
 	}
 
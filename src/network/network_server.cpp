@@ -65,12 +65,24 @@ static NetworkAuthenticationDefaultAuthorizedKeyHandler _authorized_key_handler(
 static NetworkAuthenticationDefaultAuthorizedKeyHandler _rcon_authorized_key_handler(_settings_client.network.rcon_authorized_keys); ///< Provides the authorized key validation for rcon.
 
 
-/** Writing a savegame directly to a number of packets. */
+/** Maximum number of bytes of the savegame handed to a client's send queue at once. */
+static const size_t MAP_TRANSFER_BATCH_SIZE = 1024 * 1024;
+
+/** Writing a savegame directly to a number of packets, for every client receiving the same snapshot. */
 struct PacketWriter : SaveFilter {
-	ServerNetworkGameSocketHandler *cs; ///< Socket we are associated with.
-	std::unique_ptr<Packet> current; ///< The packet we're currently writing to.
+	/** Progress of one of the clients receiving the savegame. */
+	struct Receiver {
+		ServerNetworkGameSocketHandler *cs; ///< Socket we are associated with, nullptr once it stopped receiving.
+		size_t chunk = 0; ///< Index of the chunk to continue sending from, counting the freed chunks.
+		size_t offset = 0; ///< Number of bytes of that chunk already sent.
+		bool size_sent = false; ///< Whether the size of the savegame has been sent.
+	};
+
+	std::vector<Receiver> receivers;    ///< Clients receiving this savegame.
+	std::deque<std::vector<uint8_t>> chunks; ///< The compressed savegame, shared by all receivers; packets are only made when a client can take them.
+	size_t freed_chunks = 0;            ///< Number of chunks at the front that every receiver has been sent, and that have been freed.
 	size_t total_size;                  ///< Total size of the compressed savegame.
-	std::deque<std::unique_ptr<Packet>> packets; ///< Packet queue of the savegame; send these "slowly" to the client. Cannot be a std::queue as we want to push the map size packet in front of the data packets.
+	bool finished = false;              ///< Whether the whole savegame has been written.
 	std::mutex mutex;                   ///< Mutex for making threaded saving safe.
 	std::condition_variable exit_sig;   ///< Signal for threaded destruction of this packet writer.
 
@@ -78,8 +90,9 @@ struct PacketWriter : SaveFilter {
 	 * Create the packet writer.
 	 * @param cs The socket handler we're making the packets for.
 	 */
-	PacketWriter(ServerNetworkGameSocketHandler *cs) : SaveFilter(nullptr), cs(cs), total_size(0)
+	PacketWriter(ServerNetworkGameSocketHandler *cs) : SaveFilter(nullptr), total_size(0)
 	{
+		this->receivers.push_back({cs});
 	}
 
 	/** Make sure everything is cleaned up. */
@@ -87,16 +100,62 @@ struct PacketWriter : SaveFilter {
 	{
 		std::unique_lock<std::mutex> lock(this->mutex);
 
-		while (this->cs != nullptr) this->exit_sig.wait(lock);
+		while (this->HasReceivers()) this->exit_sig.wait(lock);
+
+		/* This must all wait until the Destroy function is called for every receiver. */
+
+		this->receivers.clear();
+		this->chunks.clear();
+	}
+
+	/**
+	 * Add another client that receives the same savegame.
+	 * Must be called before the saving started.
+	 * @param cs The socket handler we're making the packets for.
+	 */
+	void AddReceiver(ServerNetworkGameSocketHandler *cs)
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->receivers.push_back({cs});
+	}
+
+	/**
+	 * Check whether any client still receives this savegame. Must be called while holding the lock.
+	 * @return True iff at least one client is receiving.
+	 */
+	bool HasReceivers() const
+	{
+		return std::ranges::any_of(this->receivers, [](const Receiver &r) { return r.cs != nullptr; });
+	}
+
+	/**
+	 * Find the progress of the given client. Must be called while holding the lock.
+	 * @param cs The socket handler to look for.
+	 * @return The receiver or nullptr if the client is not receiving this savegame.
+	 */
+	Receiver *FindReceiver(const ServerNetworkGameSocketHandler *cs)
+	{
+		auto it = std::ranges::find(this->receivers, cs, &Receiver::cs);
+		return it == this->receivers.end() ? nullptr : &*it;
+	}
 
-		/* This must all wait until the Destroy function is called. */
+	/** Free the chunks every receiver has been sent. Must be called while holding the lock. */
+	void FreeSentChunks()
+	{
+		size_t first_needed = this->freed_chunks + this->chunks.size();
+		for (const Receiver &r : this->receivers) {
+			if (r.cs != nullptr) first_needed = std::min(first_needed, r.chunk);
+		}
 
-		this->packets.clear();
-		this->current = nullptr;
+		while (this->freed_chunks < first_needed) {
+			this->chunks.pop_front();
+			this->freed_chunks++;
+		}
 	}
 
 	/**
-	 * Begin the destruction of this packet writer. It can happen in two ways:
+	 * Stop sending the savegame to a client, and begin the destruction of this
+	 * packet writer when it was the last one. It can happen in two ways:
 	 * in the first case the client disconnected while saving the map. In this
 	 * case the saving has not finished and killed this PacketWriter. In that
 	 * case we simply set cs to nullptr, triggering the appending to fail due to
@@ -104,64 +163,87 @@ struct PacketWriter : SaveFilter {
 	 * second case the destructor is already called, and it is waiting for our
 	 * signal which we will send. Only then the packets will be removed by the
 	 * destructor.
+	 * @param cs The socket handler that stops receiving.
 	 */
-	void Destroy()
+	void Destroy(const ServerNetworkGameSocketHandler *cs)
 	{
 		std::unique_lock<std::mutex> lock(this->mutex);
 
-		this->cs = nullptr;
+		Receiver *r = this->FindReceiver(cs);
+		if (r != nullptr) r->cs = nullptr;
+		bool last = !this->HasReceivers();
+		if (!last) this->FreeSentChunks();
 
 		this->exit_sig.notify_all();
 		lock.unlock();
 
 		/* Make sure the saving is completely cancelled. Yes,
 		 * we need to handle the save finish as well as the
-		 * next connection might just be requesting a map. */
-		WaitTillSaved();
+		 * next connection might just be requesting a map.
+		 * Other clients might still be receiving, then saving goes on for them. */
+		if (last) WaitTillSaved();
 	}
 
 	/**
-	 * Transfer all packets from here to the network's queue while holding
-	 * the lock on our mutex.
+	 * Transfer the next part of the savegame to the network's queue of a client
+	 * while holding the lock on our mutex. The socket only gets more once it
+	 * sent everything it got before, so a client never holds more than
+	 * #MAP_TRANSFER_BATCH_SIZE bytes of packets.
+	 * @param cs The socket handler to transfer the packets to.
 	 * @return True iff the last packet of the map has been sent.
 	 */
-	bool TransferToNetworkQueue()
+	bool TransferToNetworkQueue(ServerNetworkGameSocketHandler *cs)
 	{
-		/* Unsafe check for the queue being empty or not. */
-		if (this->packets.empty()) return false;
-
 		std::lock_guard<std::mutex> lock(this->mutex);
 
-		while (!this->packets.empty()) {
-			bool last_packet = this->packets.front()->GetPacketType() == PACKET_SERVER_MAP_DONE;
-			this->cs->SendPacket(std::move(this->packets.front()));
-			this->packets.pop_front();
+		Receiver *r = this->FindReceiver(cs);
+		if (r == nullptr || cs->HasSendQueue()) return false;
 
-			if (last_packet) return true;
+		/* Fast-track the size to the client. */
+		if (this->finished && !r->size_sent) {
+			auto p = std::make_unique<Packet>(cs, PACKET_SERVER_MAP_SIZE);
+			p->Send_uint32((uint32_t)this->total_size);
+			cs->SendPacket(std::move(p));
+			r->size_sent = true;
 		}
 
-		return false;
+		size_t end = this->freed_chunks + this->chunks.size();
+		size_t transferred = 0;
+		std::unique_ptr<Packet> p;
+		while (r->chunk < end && transferred < MAP_TRANSFER_BATCH_SIZE) {
+			if (p == nullptr) p = std::make_unique<Packet>(cs, PACKET_SERVER_MAP_DATA, TCP_MTU);
+
+			std::span<const uint8_t> chunk = this->chunks[r->chunk - this->freed_chunks];
+			size_t written = chunk.size() - r->offset - p->Send_bytes(chunk.subspan(r->offset)).size();
+			transferred += written;
+			r->offset += written;
+			if (r->offset == chunk.size()) {
+				r->chunk++;
+				r->offset = 0;
+			}
+
+			if (!p->CanWriteToPacket(1)) cs->SendPacket(std::move(p));
+		}
+		if (p != nullptr) cs->SendPacket(std::move(p));
+
+		this->FreeSentChunks();
+
+		if (!this->finished || r->chunk < end) return false;
+
+		/* Add a packet stating that this is the end to the queue. */
+		cs->SendPacket(std::make_unique<Packet>(cs, PACKET_SERVER_MAP_DONE));
+		return true;
 	}
 
 	void Write(uint8_t *buf, size_t size) override
 	{
 		std::lock_guard<std::mutex> lock(this->mutex);
 
-		/* We want to abort the saving when the socket is closed. */
-		if (this->cs == nullptr) SlError(STR_NETWORK_ERROR_LOSTCONNECTION);
-
-		if (this->current == nullptr) this->current = std::make_unique<Packet>(this->cs, PACKET_SERVER_MAP_DATA, TCP_MTU);
-
-		std::span<const uint8_t> to_write(buf, size);
-		while (!to_write.empty()) {
-			to_write = this->current->Send_bytes(to_write);
-
-			if (!this->current->CanWriteToPacket(1)) {
-				this->packets.push_back(std::move(this->current));
-				if (!to_write.empty()) this->current = std::make_unique<Packet>(this->cs, PACKET_SERVER_MAP_DATA, TCP_MTU);
-			}
-		}
+		/* We want to abort the saving when all sockets are closed. */
+		if (!this->HasReceivers()) SlError(STR_NETWORK_ERROR_LOSTCONNECTION);
 
+		if (size == 0) return;
+		this->chunks.emplace_back(buf, buf + size);
 		this->total_size += size;
 	}
 
@@ -169,19 +251,10 @@ struct PacketWriter : SaveFilter {
 	{
 		std::lock_guard<std::mutex> lock(this->mutex);
 
-		/* We want to abort the saving when the socket is closed. */
-		if (this->cs == nullptr) SlError(STR_NETWORK_ERROR_LOSTCONNECTION);
-
-		/* Make sure the last packet is flushed. */
-		if (this->current != nullptr) this->packets.push_back(std::move(this->current));
+		/* We want to abort the saving when all sockets are closed. */
+		if (!this->HasReceivers()) SlError(STR_NETWORK_ERROR_LOSTCONNECTION);
 
-		/* Add a packet stating that this is the end to the queue. */
-		this->packets.push_back(std::make_unique<Packet>(this->cs, PACKET_SERVER_MAP_DONE));
-
-		/* Fast-track the size to the client. */
-		auto p = std::make_unique<Packet>(this->cs, PACKET_SERVER_MAP_SIZE);
-		p->Send_uint32((uint32_t)this->total_size);
-		this->packets.push_front(std::move(p));
+		this->finished = true;
 	}
 };
 
@@ -214,7 +287,7 @@ ServerNetworkGameSocketHandler::~ServerNetworkGameSocketHandler()
 	OrderBackup::ResetUser(this->client_id);
 
 	if (this->savegame != nullptr) {
-		this->savegame->Destroy();
+		this->savegame->Destroy(this);
 		this->savegame = nullptr;
 	}
 
@@ -264,7 +337,7 @@ NetworkRecvStatus ServerNetworkGameSocketHandler::CloseConnection(NetworkRecvSta
 	 * process and queue the next client to receive the map. */
 	if (this->status == STATUS_MAP) {
 		/* Ensure the saving of the game is stopped too. */
-		this->savegame->Destroy();
+		this->savegame->Destroy(this);
 		this->savegame = nullptr;
 
 		this->CheckNextClientToSendMap(this);
@@ -519,10 +592,18 @@ NetworkRecvStatus ServerNetworkGameSocketHandler::SendWait()
 	return NETWORK_RECV_STATUS_OKAY;
 }
 
+/** Maximum number of clients that receive the same savegame snapshot at once. */
+static const size_t MAX_SHARED_MAP_RECEIVERS = 8;
+
 void ServerNetworkGameSocketHandler::CheckNextClientToSendMap(NetworkClientSocket *ignore_cs)
 {
 	Debug(net, 9, "client[{}] CheckNextClientToSendMap()", this->client_id);
 
+	/* Only one map transfer may run at a time; others sharing its snapshot might still be downloading. */
+	for (NetworkClientSocket *new_cs : NetworkClientSocket::Iterate()) {
+		if (new_cs != ignore_cs && new_cs->status == STATUS_MAP) return;
+	}
+
 	/* Find the best candidate for joining, i.e. the first joiner. */
 	NetworkClientSocket *best = nullptr;
 	for (NetworkClientSocket *new_cs : NetworkClientSocket::Iterate()) {
@@ -562,29 +643,43 @@ NetworkRecvStatus ServerNetworkGameSocketHandler::SendMap()
 		WaitTillSaved();
 		this->savegame = std::make_shared<PacketWriter>(this);
 
-		/* Now send the _frame_counter and how many packets are coming */
-		auto p = std::make_unique<Packet>(this, PACKET_SERVER_MAP_BEGIN);
-		p->Send_uint32(_frame_counter);
-		this->SendPacket(std::move(p));
+		/* Clients waiting for the map with the same savegame preset get the same
+		 * snapshot, so the game is serialised and compressed only once for them. */
+		std::vector<ServerNetworkGameSocketHandler *> receivers{this};
+		for (NetworkClientSocket *new_cs : NetworkClientSocket::Iterate()) {
+			if (receivers.size() >= MAX_SHARED_MAP_RECEIVERS) break;
+			if (new_cs == this || new_cs->status != STATUS_MAP_WAIT) continue;
+			if (new_cs->cm_preset.format != this->cm_preset.format || new_cs->cm_preset.compression_level != this->cm_preset.compression_level) continue;
+			this->savegame->AddReceiver(new_cs);
+			new_cs->savegame = this->savegame;
+			receivers.push_back(new_cs);
+		}
 
-		NetworkSyncCommandQueue(this);
-		Debug(net, 9, "client[{}] status = MAP", this->client_id);
-		this->status = STATUS_MAP;
-		/* Mark the start of download */
-		this->last_frame = _frame_counter;
-		this->last_frame_server = _frame_counter;
+		for (ServerNetworkGameSocketHandler *cs : receivers) {
+			/* Now send the _frame_counter and how many packets are coming */
+			auto p = std::make_unique<Packet>(cs, PACKET_SERVER_MAP_BEGIN);
+			p->Send_uint32(_frame_counter);
+			cs->SendPacket(std::move(p));
+
+			NetworkSyncCommandQueue(cs);
+			Debug(net, 9, "client[{}] status = MAP", cs->client_id);
+			cs->status = STATUS_MAP;
+			/* Mark the start of download */
+			cs->last_frame = _frame_counter;
+			cs->last_frame_server = _frame_counter;
+		}
 
 		/* Make a dump of the current game */
 		if (SaveWithFilter(this->savegame, true, this->cm_preset) != SL_OK) UserError("network savedump failed");
 	}
 
 	if (this->status == STATUS_MAP) {
-		bool last_packet = this->savegame->TransferToNetworkQueue();
+		bool last_packet = this->savegame->TransferToNetworkQueue(this);
 		if (last_packet) {
 			Debug(net, 9, "client[{}] SendMap(): last_packet", this->client_id);
 
 			/* Done reading, make sure saving is done as well */
-			this->savegame->Destroy();
+			this->savegame->Destroy(this);
 			this->savegame = nullptr;
 
 			/* Set the status to DONE_MAP, no we will wait for the client
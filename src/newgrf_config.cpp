@@ -257,7 +257,7 @@ size_t GRFGetSizeOfDataSection(FileHandle &f)
 static bool CalcGRFMD5Sum(GRFConfig &config, Subdirectory subdir)
 {
 	Md5 checksum;
-	uint8_t buffer[1024];
+	std::vector<uint8_t> buffer(64 * 1024);
 	size_t len, size;
 
 	/* open the file */
@@ -272,9 +272,9 @@ static bool CalcGRFMD5Sum(GRFConfig &config, Subdirectory subdir)
 	}
 
 	/* calculate md5sum */
-	while ((len = fread(buffer, 1, (size > sizeof(buffer)) ? sizeof(buffer) : size, *f)) != 0 && size != 0) {
+	while (size != 0 && (len = fread(buffer.data(), 1, std::min(size, buffer.size()), *f)) != 0) {
 		size -= len;
-		checksum.Append(buffer, len);
+		checksum.Append(buffer.data(), len);
 	}
 	checksum.Finish(config.ident.md5sum);
 
@@ -19,6 +19,7 @@
 #include "timer/timer_game_tick.h"
 
 #include <chrono>
+#include <ranges>
 
 #include "safeguards.h"
 
@@ -89,7 +90,11 @@ void NewGRFProfiler::EndResolve(const ResolverResult &result)
 	};
 	this->cur_call.result = std::visit(visitor{}, result);
 
-	this->calls.push_back(this->cur_call);
+	CallSummary &totals = this->summary[{this->cur_call.feat, this->cur_call.cb}];
+	totals.count++;
+	totals.microseconds += this->cur_call.time;
+
+	if (!this->aggregate_only) this->calls.push_back(this->cur_call);
 }
 
 /**
@@ -100,10 +105,16 @@ void NewGRFProfiler::RecursiveResolve()
 	this->cur_call.subs += 1;
 }
 
-void NewGRFProfiler::Start()
+/**
+ * Begin collecting data.
+ * @param aggregate_only Only keep the totals per feature and callback, which
+ *                       are printed instead of writing a file when finishing.
+ */
+void NewGRFProfiler::Start(bool aggregate_only)
 {
 	this->Abort();
 	this->active = true;
+	this->aggregate_only = aggregate_only;
 	this->start_tick = TimerGameTick::counter;
 }
 
@@ -111,6 +122,17 @@ uint32_t NewGRFProfiler::Finish()
 {
 	if (!this->active) return 0;
 
+	if (this->aggregate_only) {
+		uint32_t total_microseconds = 0;
+		for (const auto &[key, totals] : this->summary) total_microseconds += static_cast<uint32_t>(totals.microseconds);
+
+		IConsolePrint(CC_DEBUG, "Finished profile of NewGRF [{:08X}].", std::byteswap(this->grffile->grfid));
+		this->PrintSummary(SIZE_MAX);
+
+		this->Abort();
+		return total_microseconds;
+	}
+
 	if (this->calls.empty()) {
 		IConsolePrint(CC_DEBUG, "Finished profile of NewGRF [{:08X}], no events collected, not writing a file.", std::byteswap(this->grffile->grfid));
 
@@ -143,6 +165,27 @@ void NewGRFProfiler::Abort()
 {
 	this->active = false;
 	this->calls.clear();
+	this->summary.clear();
+}
+
+/**
+ * Print the feature and callback combinations that took the most time so far.
+ * @param max_lines Maximum number of combinations to print.
+ */
+void NewGRFProfiler::PrintSummary(size_t max_lines) const
+{
+	if (this->summary.empty()) {
+		IConsolePrint(CC_INFO, "No events collected for NewGRF [{:08X}].", std::byteswap(this->grffile->grfid));
+		return;
+	}
+
+	std::vector<std::pair<std::pair<GrfSpecFeature, CallbackID>, CallSummary>> hot(this->summary.begin(), this->summary.end());
+	std::ranges::sort(hot, std::greater{}, [](const auto &entry) { return entry.second.microseconds; });
+
+	IConsolePrint(CC_INFO, "NewGRF [{:08X}], {} ticks:", std::byteswap(this->grffile->grfid), TimerGameTick::counter - this->start_tick);
+	for (const auto &[key, totals] : hot | std::views::take(max_lines)) {
+		IConsolePrint(CC_INFO, "  Feature 0x{:X}, callback 0x{:X}: {} calls, {} microseconds", key.first, (uint)key.second, totals.count, totals.microseconds);
+	}
 }
 
 /**
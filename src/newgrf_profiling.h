@@ -27,9 +27,10 @@ struct NewGRFProfiler {
 	void EndResolve(const ResolverResult &result);
 	void RecursiveResolve();
 
-	void Start();
+	void Start(bool aggregate_only = false);
 	uint32_t Finish();
 	void Abort();
+	void PrintSummary(size_t max_lines) const;
 	std::string GetOutputFilename() const;
 
 	static void StartTimer(uint64_t ticks);
@@ -48,11 +49,19 @@ struct NewGRFProfiler {
 		GrfSpecFeature feat; ///< GRF feature being resolved for
 	};
 
+	/** Accumulated measurements of all resolutions of one callback of one feature. */
+	struct CallSummary {
+		uint64_t count = 0;        ///< Number of resolutions
+		uint64_t microseconds = 0; ///< Total time taken for the resolutions
+	};
+
 	const GRFFile *grffile = nullptr; ///< Which GRF is being profiled
 	bool active = false; ///< Is this profiler collecting data
+	bool aggregate_only = false; ///< Only collect the summary, not the individual calls
 	uint64_t start_tick = 0; ///< Tick number this profiler was started on
 	Call cur_call{}; ///< Data for current call in progress
 	std::vector<Call> calls{}; ///< All calls collected so far
+	std::map<std::pair<GrfSpecFeature, CallbackID>, CallSummary> summary{}; ///< Totals per feature and callback collected so far
 };
 
 extern std::vector<NewGRFProfiler> _newgrf_profilers;
@@ -177,20 +177,21 @@ static U EvalAdjustT(const DeterministicSpriteGroupAdjust &adjust, ResolverObjec
 	}
 }
 
-
-static bool RangeHighComparator(const DeterministicSpriteGroupRange &range, uint32_t value)
-{
-	return range.high < value;
-}
-
-/* virtual */ ResolverResult DeterministicSpriteGroup::Resolve(ResolverObject &object) const
+/**
+ * Evaluate a chain of variable adjusts for a variable of the given size.
+ * The size is a template parameter so the loop does not have to dispatch on it for every adjust.
+ * U is the unsigned type and S is the signed type to use.
+ * @param adjusts The adjusts to evaluate.
+ * @param object The object to resolve for.
+ * @param scope The scope to get the variables from.
+ * @param[in,out] last_value The result of the last adjust.
+ * @param[in,out] value The value of the last adjust.
+ * @return False if a variable was not available, in which case the evaluation stopped.
+ */
+template <typename U, typename S>
+static bool EvalAdjustsT(std::span<const DeterministicSpriteGroupAdjust> adjusts, ResolverObject &object, ScopeResolver *scope, uint32_t &last_value, uint32_t &value)
 {
-	uint32_t last_value = 0;
-	uint32_t value = 0;
-
-	ScopeResolver *scope = object.GetScope(this->var_scope);
-
-	for (const auto &adjust : this->adjusts) {
+	for (const auto &adjust : adjusts) {
 		/* Try to get the variable. We shall assume it is available, unless told otherwise. */
 		bool available = true;
 		if (adjust.variable == 0x7E) {
@@ -205,20 +206,39 @@ static bool RangeHighComparator(const DeterministicSpriteGroupRange &range, uint
 			value = GetVariable(object, scope, adjust.variable, adjust.parameter, available);
 		}
 
-		if (!available) {
-			/* Unsupported variable: skip further processing and return either
-			 * the group from the first range or the default group. */
-			return SpriteGroup::Resolve(this->error_group, object, false);
-		}
+		if (!available) return false;
 
-		switch (this->size) {
-			case DSG_SIZE_BYTE:  value = EvalAdjustT<uint8_t,  int8_t> (adjust, object, scope, last_value, value); break;
-			case DSG_SIZE_WORD:  value = EvalAdjustT<uint16_t, int16_t>(adjust, object, scope, last_value, value); break;
-			case DSG_SIZE_DWORD: value = EvalAdjustT<uint32_t, int32_t>(adjust, object, scope, last_value, value); break;
-			default: NOT_REACHED();
-		}
+		value = EvalAdjustT<U, S>(adjust, object, scope, last_value, value);
 		last_value = value;
 	}
+	return true;
+}
+
+static bool RangeHighComparator(const DeterministicSpriteGroupRange &range, uint32_t value)
+{
+	return range.high < value;
+}
+
+/* virtual */ ResolverResult DeterministicSpriteGroup::Resolve(ResolverObject &object) const
+{
+	uint32_t last_value = 0;
+	uint32_t value = 0;
+
+	ScopeResolver *scope = object.GetScope(this->var_scope);
+
+	bool available;
+	switch (this->size) {
+		case DSG_SIZE_BYTE:  available = EvalAdjustsT<uint8_t,  int8_t> (this->adjusts, object, scope, last_value, value); break;
+		case DSG_SIZE_WORD:  available = EvalAdjustsT<uint16_t, int16_t>(this->adjusts, object, scope, last_value, value); break;
+		case DSG_SIZE_DWORD: available = EvalAdjustsT<uint32_t, int32_t>(this->adjusts, object, scope, last_value, value); break;
+		default: NOT_REACHED();
+	}
+
+	if (!available) {
+		/* Unsupported variable: skip further processing and return either
+		 * the group from the first range or the default group. */
+		return SpriteGroup::Resolve(this->error_group, object, false);
+	}
 
 	object.last_value = last_value;
 
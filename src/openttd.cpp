@@ -383,6 +383,22 @@ void OpenBrowser(const std::string &url)
 	}
 }
 
+static std::chrono::steady_clock::time_point _startup_time; ///< When openttd_main was entered.
+static std::chrono::steady_clock::time_point _startup_phase_time; ///< When the previous startup phase ended.
+
+/**
+ * Print how long a phase of the startup took, with \c -d misc=3.
+ * @param phase Name of the phase that just ended.
+ */
+static void LogStartupPhase(std::string_view phase)
+{
+	auto now = std::chrono::steady_clock::now();
+	Debug(misc, 3, "Startup: {} took {} ms ({} ms total)", phase,
+		std::chrono::duration_cast<std::chrono::milliseconds>(now - _startup_phase_time).count(),
+		std::chrono::duration_cast<std::chrono::milliseconds>(now - _startup_time).count());
+	_startup_phase_time = now;
+}
+
 /** Callback structure of statements to be executed after the NewGRF scan. */
 struct AfterNewGRFScan : NewGRFScanCallback {
 	TimerGameCalendar::Year startyear = CalendarTime::INVALID_YEAR; ///< The start year.
@@ -405,12 +421,15 @@ struct AfterNewGRFScan : NewGRFScanCallback {
 
 	void OnNewGRFsScanned() override
 	{
+		LogStartupPhase("NewGRF scan");
 		ResetGRFConfig(false);
 
 		TarScanner::DoScan(TarScanner::Mode::Scenario);
 
 		AI::Initialize();
+		LogStartupPhase("scenario tar and AI scan");
 		Game::Initialize();
+		LogStartupPhase("game script scan");
 
 		/* We want the new (correct) NewGRF count to survive the loading. */
 		uint last_newgrf_count = _settings_client.gui.last_newgrf_count;
@@ -512,7 +531,8 @@ static std::vector<OptionData> CreateOptions()
  */
 int openttd_main(std::span<std::string_view> arguments)
 {
-	_game_session_stats.start_time = std::chrono::steady_clock::now();
+	_startup_time = _startup_phase_time = std::chrono::steady_clock::now();
+	_game_session_stats.start_time = _startup_time;
 	_game_session_stats.savegame_size = std::nullopt;
 	_game_session_stats.cm = {};
 
@@ -697,6 +717,7 @@ int openttd_main(std::span<std::string_view> arguments)
 
 	DeterminePaths(arguments[0], only_local_path);
 	TarScanner::DoScan(TarScanner::Mode::Baseset);
+	LogStartupPhase("search paths and tar scan");
 
 	if (dedicated) Debug(net, 3, "Starting dedicated server, version {}", _openttd_revision);
 	if (_dedicated_forks && !dedicated) _dedicated_forks = false;
@@ -707,6 +728,7 @@ int openttd_main(std::span<std::string_view> arguments)
 #endif
 
 	LoadFromConfig(true);
+	LogStartupPhase("config");
 
 	if (resolution.width != 0) _cur_resolution = resolution;
 
@@ -728,6 +750,7 @@ int openttd_main(std::span<std::string_view> arguments)
 
 	/* Initialize the font cache */
 	FontCache::LoadFontCaches(FONTSIZES_REQUIRED);
+	LogStartupPhase("language packs and fonts");
 
 	/* This must be done early, since functions use the SetWindowDirty* calls */
 	InitWindowSystem();
@@ -759,6 +782,8 @@ int openttd_main(std::span<std::string_view> arguments)
 		ScheduleErrorMessage(msg);
 	}
 
+	LogStartupPhase("graphics sets");
+
 	/* Initialize game palette */
 	GfxInitPalettes();
 
@@ -792,6 +817,8 @@ int openttd_main(std::span<std::string_view> arguments)
 	/* The video driver is now selected, now initialise GUI zoom */
 	UpdateGUIZoom();
 
+	LogStartupPhase("blitter and video driver");
+
 	SocialIntegration::Initialize();
 	NetworkStartUp(); // initialize network-core
 
@@ -801,6 +828,7 @@ int openttd_main(std::span<std::string_view> arguments)
 	}
 
 	VideoDriver::GetInstance()->ClaimMousePointer();
+	LogStartupPhase("network and bootstrap");
 
 	BaseSounds::FindSets();
 	if (sounds_set.empty() && !BaseSounds::ini_set.empty()) sounds_set = BaseSounds::ini_set;
@@ -829,9 +857,11 @@ int openttd_main(std::span<std::string_view> arguments)
 
 	if (musicdriver.empty() && !_ini_musicdriver.empty()) musicdriver = _ini_musicdriver;
 	DriverFactoryBase::SelectDriver(musicdriver, Driver::DT_MUSIC);
+	LogStartupPhase("sound and music");
 
 	GenerateWorld(GWM_EMPTY, 64, 64); // Make the viewport initialization happy
 	LoadIntroGame(false);
+	LogStartupPhase("intro game");
 
 	/* ScanNewGRFFiles now has control over the scanner. */
 	RequestNewGRFScan(scanner.release());
@@ -24,19 +24,55 @@ public:
 	using Key = typename Titem::Key;
 
 protected:
-	std::deque<Titem> items; ///< Storage of the nodes.
+	/**
+	 * Node and priority queue storage that outlives a single search.
+	 *  A node list is constructed for every path request, so instead of freeing
+	 *  the nodes afterwards they are kept and reused by the next search on the
+	 *  same thread.
+	 */
+	struct Storage {
+		std::deque<Titem> items; ///< Allocated nodes, only the first #used belong to the current search.
+		size_t used = 0; ///< Number of nodes in use by the current search.
+		CBinaryHeapT<Titem> open_queue{2048}; ///< Priority queue of pointers to open nodes.
+	};
+
+	/** Storage released by finished searches; a stack so nested searches each get their own. */
+	static inline thread_local std::vector<std::unique_ptr<Storage>> free_storage;
+
+	std::unique_ptr<Storage> storage; ///< Storage of the nodes and the open queue.
+	std::deque<Titem> &items; ///< Storage of the nodes.
 	HashTable<Titem, Thash_bits_open> open_nodes; ///< Hash table of pointers to open nodes.
 	HashTable<Titem, Thash_bits_closed> closed_nodes; ///< Hash table of pointers to closed nodes.
-	CBinaryHeapT<Titem> open_queue; ///< Priority queue of pointers to open nodes.
+	CBinaryHeapT<Titem> &open_queue; ///< Priority queue of pointers to open nodes.
 	Titem *new_node; ///< New node under construction.
 
+	/** Take storage left behind by an earlier search, or allocate it when there is none. */
+	static std::unique_ptr<Storage> AcquireStorage()
+	{
+		if (free_storage.empty()) return std::make_unique<Storage>();
+		std::unique_ptr<Storage> storage = std::move(free_storage.back());
+		free_storage.pop_back();
+		return storage;
+	}
+
 public:
 	/** default constructor */
-	NodeList() : open_queue(2048)
+	NodeList() : storage(AcquireStorage()), items(storage->items), open_queue(storage->open_queue)
 	{
 		this->new_node = nullptr;
 	}
 
+	/** Hand the storage back for the next search; resetting it only forgets the used nodes. */
+	~NodeList()
+	{
+		this->storage->used = 0;
+		this->open_queue.Clear();
+		free_storage.push_back(std::move(this->storage));
+	}
+
+	NodeList(const NodeList &) = delete;
+	NodeList &operator=(const NodeList &) = delete;
+
 	/** return number of open nodes */
 	inline int OpenCount()
 	{
@@ -52,13 +88,23 @@ public:
 	/** return the total number of nodes. */
 	inline int TotalCount()
 	{
-		return this->items.Length();
+		return static_cast<int>(this->storage->used);
 	}
 
 	/** allocate new data item from items */
 	inline Titem &CreateNewNode()
 	{
-		if (this->new_node == nullptr) this->new_node = &this->items.emplace_back();
+		if (this->new_node == nullptr) {
+			if (this->storage->used == this->items.size()) {
+				this->new_node = &this->items.emplace_back();
+			} else {
+				/* Recycle a node of an earlier search. */
+				this->new_node = &this->items[this->storage->used];
+				std::destroy_at(this->new_node);
+				std::construct_at(this->new_node);
+			}
+			this->storage->used++;
+		}
 		return *this->new_node;
 	}
 
@@ -97,4 +97,16 @@ bool YapfTrainCheckReverse(const Train *v);
  */
 bool YapfTrainFindNearestSafeTile(const Train *v, TileIndex tile, Trackdir td, bool override_railtype);
 
+/** Cumulative cost of the YAPF pathfinder for one vehicle type, see the 'yapf_stats' console command. */
+struct YapfStatistics {
+	uint64_t calls = 0; ///< Number of searches.
+	uint64_t nodes_open = 0; ///< Nodes still open when the searches ended.
+	uint64_t nodes_closed = 0; ///< Nodes closed (fully expanded) by the searches.
+	uint64_t cache_hits = 0; ///< Node costs reused from the segment cost cache.
+	uint64_t cache_misses = 0; ///< Node costs that had to be calculated.
+	uint64_t microseconds = 0; ///< Total time spent searching.
+};
+
+extern std::array<YapfStatistics, VEH_COMPANY_END> _yapf_statistics;
+
 #endif /* YAPF_H */
@@ -102,6 +102,7 @@ public:
 	inline bool FindPath(const VehicleType *v)
 	{
 		this->vehicle = v;
+		const auto start_time = std::chrono::steady_clock::now();
 
 		for (;;) {
 			this->num_steps++;
@@ -122,6 +123,8 @@ public:
 
 		const bool destination_found = (this->best_dest_node != nullptr);
 
+		this->UpdateStatistics(std::chrono::steady_clock::now() - start_time);
+
 		if (_debug_yapf_level >= 3) {
 			const UnitID veh_idx = (this->vehicle != nullptr) ? this->vehicle->unitnumber : 0;
 			const char ttc = Yapf().TransportTypeChar();
@@ -137,6 +140,33 @@ public:
 		return destination_found;
 	}
 
+	/**
+	 * Add the cost of the finished search to the statistics of its vehicle type.
+	 * @param duration Time the search took.
+	 */
+	inline void UpdateStatistics(std::chrono::steady_clock::duration duration)
+	{
+		::VehicleType type;
+		if constexpr (std::is_same_v<VehicleType, Train>) {
+			type = VEH_TRAIN;
+		} else if constexpr (std::is_same_v<VehicleType, RoadVehicle>) {
+			type = VEH_ROAD;
+		} else if constexpr (std::is_same_v<VehicleType, Ship>) {
+			type = VEH_SHIP;
+		} else {
+			/* Not a vehicle, e.g. the river builder. */
+			return;
+		}
+
+		YapfStatistics &stats = _yapf_statistics[type];
+		stats.calls++;
+		stats.nodes_open += this->nodes.OpenCount();
+		stats.nodes_closed += this->nodes.ClosedCount();
+		stats.cache_hits += this->stats_cache_hits;
+		stats.cache_misses += this->stats_cost_calcs;
+		stats.microseconds += std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+	}
+
 	/**
 	 * If path was found return the best node that has reached the destination. Otherwise
 	 *  return the best visited node (which was nearest to the destination).
@@ -661,6 +661,7 @@ bool YapfTrainFindNearestSafeTile(const Train *v, TileIndex tile, Trackdir td, b
 
 /** if any track changes, this counter is incremented - that will invalidate segment cost cache */
 int CSegmentCostCacheBase::s_rail_change_counter = 0;
+std::array<YapfStatistics, VEH_COMPANY_END> _yapf_statistics;
 
 void YapfNotifyTrackLayoutChange(TileIndex tile, Track track)
 {
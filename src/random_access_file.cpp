@@ -42,6 +42,8 @@ RandomAccessFile::RandomAccessFile(std::string_view filename, Subdirectory subdi
 	this->simplified_filename = name_without_path.substr(0, name_without_path.rfind('.'));
 	strtolower(this->simplified_filename);
 
+	this->pos = 0;
+	this->buffer = this->buffer_end = this->buffer_start;
 	this->SeekTo(static_cast<size_t>(pos), SEEK_SET);
 }
 
@@ -91,6 +93,13 @@ void RandomAccessFile::SeekTo(size_t pos, int mode)
 {
 	if (mode == SEEK_CUR) pos += this->GetPos();
 
+	/* Sprites are often read close to each other, so keep the buffer when the new position is still inside it. */
+	size_t buffer_begin_pos = this->pos - (this->buffer_end - this->buffer_start);
+	if (pos >= buffer_begin_pos && pos < this->pos) {
+		this->buffer = this->buffer_start + (pos - buffer_begin_pos);
+		return;
+	}
+
 	this->pos = pos;
 	if (fseek(*this->file_handle, this->pos, SEEK_SET) < 0) {
 		Debug(misc, 0, "Seeking in {} failed", this->filename);
@@ -154,6 +163,7 @@ void RandomAccessFile::ReadBlock(void *ptr, size_t size)
 	}
 
 	this->pos += fread(ptr, 1, size, *this->file_handle);
+	this->buffer = this->buffer_end = this->buffer_start;
 }
 
 /**
@@ -54,16 +54,14 @@ struct CMDLChunkHandler : ChunkHandler {
 		TempStorage storage;
 
 		int i = 0;
-		CargoMonitorMap::const_iterator iter = _cargo_deliveries.begin();
-		while (iter != _cargo_deliveries.end()) {
-			storage.number = iter->first;
-			storage.amount = iter->second;
+		for (const auto &[number, amount] : _cargo_deliveries.GetSorted()) {
+			storage.number = number;
+			storage.amount = amount;
 
 			SlSetArrayIndex(i);
 			SlObject(&storage, _cargomonitor_pair_desc);
 
 			i++;
-			iter++;
 		}
 	}
 
@@ -81,7 +79,7 @@ struct CMDLChunkHandler : ChunkHandler {
 
 			if (fix) storage.number = FixupCargoMonitor(storage.number);
 
-			_cargo_deliveries.emplace(storage.number, storage.amount);
+			_cargo_deliveries.GetShard(storage.number).emplace(storage.number, storage.amount);
 		}
 	}
 };
@@ -97,16 +95,14 @@ struct CMPUChunkHandler : ChunkHandler {
 		TempStorage storage;
 
 		int i = 0;
-		CargoMonitorMap::const_iterator iter = _cargo_pickups.begin();
-		while (iter != _cargo_pickups.end()) {
-			storage.number = iter->first;
-			storage.amount = iter->second;
+		for (const auto &[number, amount] : _cargo_pickups.GetSorted()) {
+			storage.number = number;
+			storage.amount = amount;
 
 			SlSetArrayIndex(i);
 			SlObject(&storage, _cargomonitor_pair_desc);
 
 			i++;
-			iter++;
 		}
 	}
 
@@ -124,7 +120,7 @@ struct CMPUChunkHandler : ChunkHandler {
 
 			if (fix) storage.number = FixupCargoMonitor(storage.number);
 
-			_cargo_pickups.emplace(storage.number, storage.amount);
+			_cargo_pickups.GetShard(storage.number).emplace(storage.number, storage.amount);
 		}
 	}
 };
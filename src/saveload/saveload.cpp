@@ -48,6 +48,7 @@
 #include "../newgrf_railtype.h"
 #include "../newgrf_roadtype.h"
 #include "../settings_internal.h"
+#include "../worker_pool.h"
 #include "saveload_internal.h"
 #include "saveload_filter.h"
 
@@ -56,6 +57,11 @@
 #ifdef __EMSCRIPTEN__
 #	include <emscripten.h>
 #endif
+#if defined(UNIX) && !defined(__EMSCRIPTEN__)
+#	include <sys/wait.h>
+#	include <unistd.h>
+#	define WITH_FORKED_SAVES
+#endif
 
 #ifdef WITH_LZO
 #include <lzo/lzo1x.h>
@@ -132,6 +138,31 @@ struct ReadBuffer {
 		return *this->bufp++;
 	}
 
+	/**
+	 * Read a block of bytes.
+	 * @param ptr Where to store the bytes.
+	 * @param length The number of bytes to read.
+	 */
+	void CopyBytes(uint8_t *ptr, size_t length)
+	{
+		while (length > 0) {
+			if (this->bufp == this->bufe) {
+				size_t len = this->reader->Read(this->buf, lengthof(this->buf));
+				if (len == 0) SlErrorCorrupt("Unexpected end of chunk");
+
+				this->read += len;
+				this->bufp = this->buf;
+				this->bufe = this->buf + len;
+			}
+
+			size_t to_copy = std::min<size_t>(this->bufe - this->bufp, length);
+			std::copy_n(this->bufp, to_copy, ptr);
+			this->bufp += to_copy;
+			ptr += to_copy;
+			length -= to_copy;
+		}
+	}
+
 	/**
 	 * Get the size of the memory dump made so far.
 	 * @return The size.
@@ -164,6 +195,27 @@ struct MemoryDumper {
 		*this->buf++ = b;
 	}
 
+	/**
+	 * Write a block of bytes into the dumper.
+	 * @param ptr The bytes to write.
+	 * @param length The number of bytes to write.
+	 */
+	void CopyBytes(const uint8_t *ptr, size_t length)
+	{
+		while (length > 0) {
+			if (this->buf == this->bufe) {
+				this->buf = this->blocks.emplace_back(std::make_unique<uint8_t[]>(MEMORY_CHUNK_SIZE)).get();
+				this->bufe = this->buf + MEMORY_CHUNK_SIZE;
+			}
+
+			size_t to_copy = std::min<size_t>(this->bufe - this->buf, length);
+			std::copy_n(ptr, to_copy, this->buf);
+			this->buf += to_copy;
+			ptr += to_copy;
+			length -= to_copy;
+		}
+	}
+
 	/**
 	 * Flush this dumper into a writer.
 	 * @param writer The filter we want to use.
@@ -389,11 +441,40 @@ static void SetAsyncSaveFinish(AsyncSaveFinishProc proc)
 	_async_save_finish.store(proc, std::memory_order_release);
 }
 
+#ifdef WITH_FORKED_SAVES
+static pid_t _save_child = -1; ///< Process writing a forked save, or -1 when there is none.
+static void SaveFileDone();
+
+/**
+ * Reap the process of a forked save when it has finished.
+ * @param block Whether to wait for it to finish.
+ */
+static void CheckForkedSave(bool block)
+{
+	if (_save_child < 0) return;
+
+	int status;
+	pid_t res;
+	do {
+		res = waitpid(_save_child, &status, block ? 0 : WNOHANG);
+	} while (res < 0 && errno == EINTR);
+	if (res == 0) return; // Still writing.
+
+	_save_child = -1;
+	if (res < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) Debug(sl, 0, "Forked save failed");
+	SaveFileDone();
+}
+#endif /* WITH_FORKED_SAVES */
+
 /**
  * Handle async save finishes.
  */
 void ProcessAsyncSaveFinish()
 {
+#ifdef WITH_FORKED_SAVES
+	CheckForkedSave(false);
+#endif
+
 	AsyncSaveFinishProc proc = _async_save_finish.exchange(nullptr, std::memory_order_acq_rel);
 	if (proc == nullptr) return;
 
@@ -788,11 +869,39 @@ static void SlCopyBytes(void *ptr, size_t length)
 	switch (_sl.action) {
 		case SLA_LOAD_CHECK:
 		case SLA_LOAD:
-			for (; length != 0; length--) *p++ = SlReadByte();
+			_sl.reader->CopyBytes(p, length);
 			break;
 		case SLA_SAVE:
-			for (; length != 0; length--) SlWriteByte(*p++);
+			_sl.dumper->CopyBytes(p, length);
+			break;
+		default: NOT_REACHED();
+	}
+}
+
+/**
+ * Save/Load an array of 16 bit values; in the savegame they are stored big endian.
+ * @param ptr The array.
+ * @param length The number of elements.
+ */
+static void SlCopyUint16s(uint16_t *ptr, size_t length)
+{
+	switch (_sl.action) {
+		case SLA_LOAD_CHECK:
+		case SLA_LOAD:
+			SlCopyBytes(ptr, length * sizeof(uint16_t));
+			std::transform(ptr, ptr + length, ptr, FROM_BE16);
+			break;
+		case SLA_SAVE: {
+			std::array<uint16_t, 1024> buf;
+			while (length > 0) {
+				size_t n = std::min(length, buf.size());
+				std::transform(ptr, ptr + n, buf.begin(), TO_BE16);
+				SlCopyBytes(buf.data(), n * sizeof(uint16_t));
+				ptr += n;
+				length -= n;
+			}
 			break;
+		}
 		default: NOT_REACHED();
 	}
 }
@@ -1129,6 +1238,9 @@ static void SlCopyInternal(void *object, size_t length, VarType conv)
 	 * conversion is needed, use specialized copy-copy function to speed up things */
 	if (conv == SLE_INT8 || conv == SLE_UINT8) {
 		SlCopyBytes(object, length);
+	} else if (conv == SLE_INT16 || conv == SLE_UINT16) {
+		/* Same size in file and memory, only the byte order may differ. */
+		SlCopyUint16s(static_cast<uint16_t *>(object), length);
 	} else {
 		uint8_t *a = (uint8_t*)object;
 		uint8_t mem_size = SlCalcConvMemLen(conv);
@@ -2425,6 +2537,17 @@ struct FileWriter : SaveFilter {
 	}
 };
 
+/**
+ * Get the number of threads compressors that support it may use for saving.
+ * @return Number of threads, 1 means single threaded compression.
+ */
+[[maybe_unused]] static uint GetSaveCompressionThreads()
+{
+	/* More threads hardly help as the saving itself runs on a single thread. */
+	static const uint MAX_SAVE_COMPRESSION_THREADS = 8;
+	return std::min(WorkerPool::GetDefaultWorkerCount(), MAX_SAVE_COMPRESSION_THREADS);
+}
+
 /*******************************************
  ********** START OF LZO CODE **************
  *******************************************/
@@ -2740,6 +2863,18 @@ struct LZMASaveFilter : SaveFilter {
 	 */
 	LZMASaveFilter(std::shared_ptr<SaveFilter> chain, uint8_t compression_level) : SaveFilter(std::move(chain)), lzma(_lzma_init)
 	{
+#if LZMA_VERSION >= 50020002
+		/* The multithreaded encoder splits the stream into independently compressed
+		 * blocks, the result is still a regular xz stream the normal decoder reads. */
+		uint threads = GetSaveCompressionThreads();
+		if (threads > 1) {
+			lzma_mt mt{};
+			mt.threads = threads;
+			mt.preset = compression_level;
+			mt.check = LZMA_CHECK_CRC32;
+			if (lzma_stream_encoder_mt(&this->lzma, &mt) == LZMA_OK) return;
+		}
+#endif
 		if (lzma_easy_encoder(&this->lzma, compression_level, LZMA_CHECK_CRC32) != LZMA_OK) SlError(STR_GAME_SAVELOAD_ERROR_BROKEN_INTERNAL_ERROR, "cannot initialize compressor");
 	}
 
@@ -2858,6 +2993,10 @@ struct ZSTDSaveFilter : SaveFilter {
 			ZSTD_freeCCtx(this->zstd);
 			SlError(STR_GAME_SAVELOAD_ERROR_BROKEN_INTERNAL_ERROR, "invalid compresison level");
 		}
+		/* Compress blocks in parallel, the output is a regular zstd frame. This fails
+		 * when libzstd is built without multithreading, then just stay single threaded. */
+		uint threads = GetSaveCompressionThreads();
+		if (threads > 1) ZSTD_CCtx_setParameter(this->zstd, ZSTD_c_nbWorkers, (int)threads);
 	}
 
 	/** Clean up what we allocated. */
@@ -3243,6 +3382,10 @@ static SaveOrLoadResult SaveFileToDisk(bool threaded, citymania::SavePreset pres
 
 void WaitTillSaved()
 {
+#ifdef WITH_FORKED_SAVES
+	CheckForkedSave(true);
+#endif
+
 	if (!_save_thread.joinable()) return;
 
 	_save_thread.join();
@@ -3285,6 +3428,44 @@ static SaveOrLoadResult DoSave(std::shared_ptr<SaveFilter> writer, bool threaded
 	return SL_OK;
 }
 
+#ifdef WITH_FORKED_SAVES
+/**
+ * Save the game to a file from a forked process. The child serialises and
+ * compresses its copy-on-write snapshot of the game state, so unlike a
+ * threaded save the game loop does not stop for SlSaveChunks either.
+ * The parent notices completion in ProcessAsyncSaveFinish.
+ * @param file The file to write to.
+ * @param preset The format to save with.
+ * @return Whether the child was started; if not, the caller has to save normally.
+ */
+static bool DoForkedSave(FileHandle &file, citymania::SavePreset preset)
+{
+	/* Anything still buffered would otherwise be written by both processes. */
+	fflush(nullptr);
+
+	pid_t pid = fork();
+	if (pid < 0) {
+		Debug(sl, 1, "Cannot fork for saving, reverting to threaded mode...");
+		return false;
+	}
+
+	if (pid == 0) {
+		/* Only the calling thread exists in the child; save without threads and leave without running any destructors. */
+		SaveOrLoadResult result = SL_ERROR;
+		try {
+			result = DoSave(std::make_shared<FileWriter>(std::move(file)), false, preset);
+		} catch (...) {
+		}
+		fflush(nullptr);
+		_exit(result == SL_OK ? 0 : 1);
+	}
+
+	_save_child = pid;
+	SaveFileStart();
+	return true;
+}
+#endif /* WITH_FORKED_SAVES */
+
 /**
  * Save the game using a (writer) filter.
  * @param writer   The filter to write the savegame to.
@@ -3539,6 +3720,9 @@ SaveOrLoadResult SaveOrLoad(std::string_view filename, SaveLoadOperation fop, De
 		if (fop == SLO_SAVE) { // SAVE game
 			Debug(desync, 1, "save: {:08x}; {:02x}; {}", TimerGameEconomy::date, TimerGameEconomy::date_fract, filename);
 			if (!_settings_client.gui.threaded_saves) threaded = false;
+#ifdef WITH_FORKED_SAVES
+			if (threaded && _network_dedicated && _settings_client.network.fork_saves && DoForkedSave(*fh, citymania::GetLocalSavePreset())) return SL_OK;
+#endif
 
 			return DoSave(std::make_shared<FileWriter>(std::move(*fh)), threaded, citymania::GetLocalSavePreset());
 		}
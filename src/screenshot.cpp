@@ -46,7 +46,7 @@ uint _heightmap_highest_peak;         ///< When saving a heightmap, this contain
  * If the selected provider is not found, then the first provider will be used instead.
  * @returns ScreenshotProvider, or null if none exist.
  */
-static const ScreenshotProvider *GetScreenshotProvider()
+/* CM static */ const ScreenshotProvider *GetScreenshotProvider()
 {
 	const auto &providers = ProviderManager<ScreenshotProvider>::GetProviders();
 	if (providers.empty()) return nullptr;
@@ -85,7 +85,7 @@ static void CurrentScreenCallback(void *buf, uint y, uint pitch, uint n)
  * @param pitch Pitch of the videobuffer
  * @param n Number of lines to render
  */
-static void LargeWorldCallback(Viewport &vp, void *buf, uint y, uint pitch, uint n)
+/* CM static */ void LargeWorldCallback(Viewport &vp, void *buf, uint y, uint pitch, uint n)
 {
 	DrawPixelInfo dpi{
 		.dst_ptr = buf,
@@ -28,6 +28,14 @@ void MakeScreenshotWithConfirm(ScreenshotType t);
 bool MakeScreenshot(ScreenshotType t, const std::string &name, uint32_t width = 0, uint32_t height = 0);
 bool MakeMinimapWorldScreenshot();
 
+/* CityMania code start */
+struct Viewport;
+class ScreenshotProvider;
+
+const ScreenshotProvider *GetScreenshotProvider();
+void LargeWorldCallback(Viewport &vp, void *buf, uint y, uint pitch, uint n);
+/* CityMania code end */
+
 extern std::string _screenshot_format_name;
 extern std::string _full_screenshot_path;
 
@@ -12,6 +12,7 @@
 #include "debug.h"
 #include "fileio_func.h"
 #include "screenshot_type.h"
+#include "worker_pool.h"
 #include "3rdparty/fmt/ranges.h"
 
 #include <png.h>
@@ -143,23 +144,56 @@ public:
 		maxlines = Clamp(65536 / w, 16, 128);
 
 		/* now generate the bitmap bits */
-		std::vector<uint8_t> buff(static_cast<size_t>(w) * maxlines * bpp); // by default generate 128 lines at a time.
+		std::array<std::vector<uint8_t>, 2> buffs; // by default generate 128 lines at a time.
+		for (auto &buff : buffs) buff.resize(static_cast<size_t>(w) * maxlines * bpp);
+
+		/* Compress the previous lines on a worker thread while rendering the next ones.
+		 * Errors longjmp to the setjmp of the thread calling libpng, so each side sets its own. */
+		bool write_failed = false;
+		auto write_rows = [png_ptr, w, bpp, &write_failed](const uint8_t *rows, uint count) {
+			if (setjmp(png_jmpbuf(png_ptr))) {
+				write_failed = true;
+				return;
+			}
+			for (uint row = 0; row != count; row++) {
+				png_write_row(png_ptr, rows + row * w * bpp);
+			}
+		};
 
+		WorkerPool writer("ottd:png");
+		if (h > maxlines) writer.Start(1);
+
+		std::future<void> written;
+		uint cur = 0;
 		y = 0;
 		do {
 			/* determine # lines to write */
 			n = std::min(h - y, maxlines);
 
 			/* render the pixels into the buffer */
-			callb(buff.data(), y, w, n);
+			callb(buffs[cur].data(), y, w, n);
 			y += n;
 
-			/* write them to png */
-			for (i = 0; i != n; i++) {
-				png_write_row(png_ptr, (png_bytep)buff.data() + i * w * bpp);
-			}
+			/* write them to png, after the previous lines are */
+			if (written.valid()) written.wait();
+			if (write_failed) break;
+			written = writer.Submit([&write_rows, rows = buffs[cur].data(), n]() { write_rows(rows, n); });
+			cur ^= 1;
 		} while (y != h);
 
+		if (written.valid()) written.wait();
+		writer.Stop();
+
+		if (write_failed) {
+			png_destroy_write_struct(&png_ptr, &info_ptr);
+			return false;
+		}
+
+		if (setjmp(png_jmpbuf(png_ptr))) {
+			png_destroy_write_struct(&png_ptr, &info_ptr);
+			return false;
+		}
+
 		png_write_end(png_ptr, info_ptr);
 		png_destroy_write_struct(&png_ptr, &info_ptr);
 
@@ -29,6 +29,8 @@
  * \li AIError::ERR_BRIDGE_TOO_LOW
  * \li AIEngine::GetAllRailTypes
  * \li AITile::IsHouseTile
+ * \li AITownList_Population
+ * \li AITownList_LastMonthSupplied
  *
  * Other changes:
  * \li AIBridge::GetBridgeID renamed to AIBridge::GetBridgeType
@@ -9,6 +9,7 @@
 
 #include "../../stdafx.h"
 #include "script_townlist.hpp"
+#include "script_cargo.hpp"
 #include "../../town.h"
 
 #include "../../safeguards.h"
@@ -18,6 +19,23 @@ ScriptTownList::ScriptTownList(HSQUIRRELVM vm)
 	ScriptList::FillList<Town>(vm, this);
 }
 
+ScriptTownList_Population::ScriptTownList_Population()
+{
+	for (const Town *t : Town::Iterate()) {
+		this->AddItem(t->index.base(), t->cache.population);
+	}
+}
+
+ScriptTownList_LastMonthSupplied::ScriptTownList_LastMonthSupplied(CargoType cargo_type)
+{
+	if (!ScriptCargo::IsValidCargo(cargo_type)) return;
+
+	for (const Town *t : Town::Iterate()) {
+		auto it = t->GetCargoSupplied(cargo_type);
+		this->AddItem(t->index.base(), it == std::end(t->supplied) ? 0 : it->history[LAST_MONTH].transported);
+	}
+}
+
 ScriptTownEffectList::ScriptTownEffectList()
 {
 	for (int i = TAE_BEGIN; i < TAE_END; i++) {
@@ -47,6 +47,33 @@ public:
 #endif /* DOXYGEN_API */
 };
 
+/**
+ * Creates a list of towns that are currently on the map, with their population as value.
+ * This is a faster alternative to valuating a ScriptTownList with ScriptTown::GetPopulation.
+ * @api ai game
+ * @ingroup ScriptList
+ */
+class ScriptTownList_Population : public ScriptList {
+public:
+	ScriptTownList_Population();
+};
+
+/**
+ * Creates a list of towns that are currently on the map, with the amount of
+ * the given cargo transported from each town last month as value.
+ * This is a faster alternative to valuating a ScriptTownList with ScriptTown::GetLastMonthSupplied.
+ * @api ai game
+ * @ingroup ScriptList
+ */
+class ScriptTownList_LastMonthSupplied : public ScriptList {
+public:
+	/**
+	 * @param cargo_type The cargo to get the supplied amount for.
+	 * @pre ScriptCargo::IsValidCargo(cargo_type).
+	 */
+	ScriptTownList_LastMonthSupplied(CargoType cargo_type);
+};
+
 /**
  * Creates a list of all TownEffects known in the game.
  * @api ai game
@@ -275,8 +275,11 @@ void ScriptInstance::GameLoop()
 void ScriptInstance::CollectGarbage()
 {
 	if (this->is_started && !this->IsDead()) {
+		if (this->engine->GetAllocatedMemory() <= this->collected_memory) return;
+
 		ScriptObject::ActiveInstance active(*this);
 		this->engine->CollectGarbage();
+		this->collected_memory = this->engine->GetAllocatedMemory();
 	}
 }
 
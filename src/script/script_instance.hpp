@@ -85,6 +85,9 @@ public:
 
 	/**
 	 * Let the VM collect any garbage.
+	 * The collection is skipped when the script has not allocated more memory than
+	 * was left after the previous collection, as a full cycle over a large script
+	 * can take several milliseconds while there is little new garbage to find.
 	 */
 	void CollectGarbage();
 
@@ -300,6 +303,7 @@ private:
 	bool in_shutdown = false; ///< Is this instance currently being destructed?
 	Script_SuspendCallbackProc *callback = nullptr; ///< Callback that should be called in the next tick the script runs.
 	size_t last_allocated_memory = 0; ///< Last known allocated memory value (for display for crashed scripts)
+	size_t collected_memory = 0; ///< Allocated memory right after the last garbage collection
 
 	/**
 	 * Call the script Load function if it exists and data was loaded
@@ -52,6 +52,8 @@
 #include "fios.h"
 #include "fileio_func.h"
 #include "settings_cmd.h"
+#include "timer/timer.h"
+#include "timer/timer_window.h"
 
 #include "table/strings.h"
 
@@ -1467,9 +1469,41 @@ void LoadFromConfig(bool startup)
 	}
 }
 
+/** Minimum time between two saves of the configuration caused by setting changes. */
+static const std::chrono::seconds CONFIG_SAVE_DELAY(2);
+
+/**
+ * Whether a setting changed since the configuration was last saved.
+ * This is set for changes that follow a save within #CONFIG_SAVE_DELAY;
+ * #_deferred_config_save_interval then saves them, so a burst of changes (e.g.
+ * clicking through a setting's values) rewrites the configuration files only once.
+ */
+static bool _config_save_pending = false;
+static std::chrono::steady_clock::time_point _last_config_save{}; ///< When the configuration was last saved.
+
+/** Save the configuration a short while after a setting changed. */
+static const IntervalTimer<TimerWindow> _deferred_config_save_interval(CONFIG_SAVE_DELAY, [](auto) {
+	if (_config_save_pending) SaveToConfig();
+});
+
+/** Save the configuration after a setting changed, unless it was just saved; then leave it to the deferred save. */
+static void SaveToConfigAfterChange()
+{
+	if (!_save_config) return;
+
+	if (std::chrono::steady_clock::now() - _last_config_save >= CONFIG_SAVE_DELAY) {
+		SaveToConfig();
+	} else {
+		_config_save_pending = true;
+	}
+}
+
 /** Save the values to the configuration file */
 void SaveToConfig()
 {
+	_config_save_pending = false;
+	_last_config_save = std::chrono::steady_clock::now();
+
 	ConfigIniFile generic_ini(_config_file);
 	ConfigIniFile private_ini(_private_file);
 	ConfigIniFile secrets_ini(_secrets_file);
@@ -1629,7 +1663,7 @@ void IntSettingDesc::ChangeValue(const void *object, int32_t newval) const
 	SetWindowClassesDirty(WC_GAME_OPTIONS);
 	if (this->flags.Test(SettingFlag::Sandbox)) SetWindowClassesDirty(WC_CHEATS);
 
-	if (_save_config) SaveToConfig();
+	SaveToConfigAfterChange();
 }
 
 /**
@@ -1920,7 +1954,7 @@ void StringSettingDesc::ChangeValue(const void *object, std::string &&newval) co
 	this->Write(object, newval);
 	if (this->post_callback != nullptr) this->post_callback(newval);
 
-	if (_save_config) SaveToConfig();
+	SaveToConfigAfterChange();
 }
 
 /* Those 2 functions need to be here, else we have to make some stuff non-static
@@ -1429,6 +1429,8 @@ struct GameOptionsWindow : Window {
 				break;
 
 			case WID_GO_LANG_DROPDOWN: // Change interface language
+				/* Picking the current language again would only redo all the work below. */
+				if (&_languages[index] == _current_language) break;
 				ReadLanguagePack(&_languages[index]);
 				CloseWindowByClass(WC_QUERY_STRING);
 				CheckForMissingGlyphs();
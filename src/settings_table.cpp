@@ -17,6 +17,7 @@
 #include "network/network_func.h"
 #include "network/core/config.h"
 #include "pathfinder/pathfinder_type.h"
+#include "pathfinder/yapf/yapf_cache.h"
 #include "linkgraph/linkgraphschedule.h"
 #include "genworld.h"
 #include "train.h"
@@ -562,6 +563,12 @@ static void StationCatchmentChanged(int32_t)
 	MarkWholeScreenDirty();
 }
 
+/** Rail pathfinder penalties are part of the cached segment costs, so drop those. */
+static void RailPathfinderPenaltiesChanged(int32_t)
+{
+	YapfNotifyTrackLayoutChange(INVALID_TILE, INVALID_TRACK);
+}
+
 static void MaxVehiclesChanged(int32_t)
 {
 	InvalidateWindowClassesData(WC_BUILD_TOOLBAR);
@@ -300,6 +300,8 @@ struct GUISettings {
 	bool cm_enable_polyrail_terraform;
 	bool cm_invert_fn_for_signal_drag;
 	bool cm_toolbar_dropdown_close;
+	uint8 cm_linkgraph_threads;              ///< number of threads to run link graph jobs on, 0 = number of hardware threads
+	uint8 cm_cache_check_interval;           ///< number of ticks between cache checks with '-d desync=2' or higher
 	/* CityMania code end */
 
 	/**
@@ -412,6 +414,7 @@ struct NetworkSettings {
 	uint16_t      restart_hours;                          ///< number of hours to run the server before automatic restart
 	uint8_t       min_active_clients;                       ///< minimum amount of active clients to unpause the game
 	bool        reload_cfg;                               ///< reload the config file before restarting
+	bool        fork_saves;                               ///< dedicated server: write threaded saves from a forked process (POSIX only)
 	std::string last_joined;                              ///< Last joined server
 	UseRelayService use_relay_service;                    ///< Use relay service?
 	ParticipateSurvey participate_survey;                 ///< Participate in the automated survey
@@ -421,7 +421,7 @@ static const AndOr _smallmap_vehicles_andor[] = {
 };
 
 /** Mapping of tile type to importance of the tile (higher number means more interesting to show). */
-static const uint8_t _tiletype_importance[] = {
+static constexpr uint8_t _tiletype_importance[] = {
 	2, // MP_CLEAR
 	8, // MP_RAILWAY
 	7, // MP_ROAD
@@ -435,6 +435,8 @@ static const uint8_t _tiletype_importance[] = {
 	2, // MP_OBJECT
 	0,
 };
+/** Highest value in #_tiletype_importance. */
+static constexpr uint8_t MAX_TILETYPE_IMPORTANCE = std::ranges::max(_tiletype_importance);
 
 
 /**
@@ -1367,6 +1369,7 @@ protected:
 		int importance = 0;
 		TileIndex tile = INVALID_TILE; // Position of the most important tile.
 		TileType et = MP_VOID;         // Effective tile type at that position.
+		const bool check_industries = this->map_type == SMT_INDUSTRY || this->map_type == CM_SMT_IMBA;
 
 		for (TileIndex ti : ta) {
 			TileType ttype = GetTileType(ti);
@@ -1385,7 +1388,7 @@ protected:
 
 				case MP_INDUSTRY:
 					/* Special handling of industries while in "Industries" smallmap view. */
-					if (this->map_type == SMT_INDUSTRY || this->map_type == CM_SMT_IMBA) {
+					if (check_industries) {
 						/* If industry is allowed to be seen, use its colour on the map.
 						 * This has the highest priority above any value in _tiletype_importance. */
 						IndustryType type = Industry::GetByTile(ti)->type;
@@ -1409,6 +1412,8 @@ protected:
 				importance = _tiletype_importance[ttype];
 				tile = ti;
 				et = ttype;
+				/* Nothing can beat a station anymore, unless an industry later in the area overrides everything. */
+				if (importance == MAX_TILETYPE_IMPORTANCE && !check_industries) break;
 			}
 		}
 
@@ -278,10 +278,42 @@ public:
 		const bool desc = this->flags.Test(SortListFlag::Desc);
 
 		if constexpr (std::is_same_v<P, std::nullptr_t>) {
-			std::sort(std::vector<T>::begin(), std::vector<T>::end(), [&](const T &a, const T &b) { return desc ? compare(b, a) : compare(a, b); });
+			return this->SortAdaptive([&](const T &a, const T &b) { return desc ? compare(b, a) : compare(a, b); });
 		} else {
-			std::sort(std::vector<T>::begin(), std::vector<T>::end(), [&](const T &a, const T &b) { return desc ? compare(b, a, params) : compare(a, b, params); });
+			return this->SortAdaptive([&](const T &a, const T &b) { return desc ? compare(b, a, params) : compare(a, b, params); });
 		}
+	}
+
+	/**
+	 * Sort the list, reusing the part that is still in order.
+	 * Periodic resorts mostly find the list already sorted, with a few items
+	 * appended at the end or a few items whose key moved them forward, e.g. a
+	 * town that grew. Those items are taken out, sorted on their own and then
+	 * merged back into the part that stayed in order.
+	 * @param compare The function to compare two list items
+	 * @return true if the list sequence has been altered
+	 */
+	template <typename Comp>
+	bool SortAdaptive(Comp compare)
+	{
+		auto first_unsorted = std::is_sorted_until(std::vector<T>::begin(), std::vector<T>::end(), compare);
+		if (first_unsorted == std::vector<T>::end()) return false;
+
+		/* Keep every item that does not sort before the last kept one, in place. */
+		std::vector<T> moved;
+		auto kept_end = first_unsorted;
+		for (auto it = first_unsorted; it != std::vector<T>::end(); ++it) {
+			if (compare(*it, *std::prev(kept_end))) {
+				moved.push_back(std::move(*it));
+			} else {
+				if (kept_end != it) *kept_end = std::move(*it);
+				++kept_end;
+			}
+		}
+
+		std::sort(moved.begin(), moved.end(), compare);
+		std::move(moved.begin(), moved.end(), kept_end);
+		std::inplace_merge(std::vector<T>::begin(), kept_end, std::vector<T>::end(), compare);
 		return true;
 	}
 
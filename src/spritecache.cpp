@@ -204,6 +204,15 @@ SpriteID GetMaxSpriteID()
 	return static_cast<SpriteID>(_spritecache.size());
 }
 
+/**
+ * Get the number of bytes currently used by cached sprite data.
+ * @return Bytes in use by the sprite cache.
+ */
+size_t GetSpriteCacheUsage()
+{
+	return _spritecache_bytes_used;
+}
+
 static bool ResizeSpriteIn(SpriteLoader::SpriteCollection &sprite, ZoomLevel src, ZoomLevel tgt)
 {
 	uint8_t scaled_1 = AdjustByZoom(1, src - tgt);
@@ -762,7 +771,8 @@ static void DeleteEntriesFromSpriteCache(size_t to_remove)
 void IncreaseSpriteLRU()
 {
 	int bpp = BlitterFactory::GetCurrentBlitter()->GetScreenDepth();
-	uint target_size = (bpp > 0 ? _sprite_cache_size * bpp / 8 : 1) * 1024 * 1024;
+	/* The configured size is in MB for 8bpp sprites; 32bpp sprites need four times as much. */
+	size_t target_size = (bpp > 0 ? static_cast<size_t>(_sprite_cache_size) * bpp / 8 : 1) * 1024 * 1024;
 	if (_spritecache_bytes_used > target_size) {
 		DeleteEntriesFromSpriteCache(_spritecache_bytes_used - target_size + 512 * 1024);
 	}
@@ -31,6 +31,7 @@
 
 #include "table/strings.h"
 
+#include "citymania/cm_highlight.hpp"
 #include "citymania/cm_station_gui.hpp"
 
 #include "safeguards.h"
@@ -479,6 +480,7 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 {
 	this->industries_near.clear();
 	if (!no_clear_nearby_lists) this->RemoveFromAllNearbyLists();
+	citymania::InvalidateStationCatchmentBorders(this);
 
 	if (this->rect.IsEmpty()) {
 		this->catchment_tiles.Reset();
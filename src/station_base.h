@@ -10,6 +10,7 @@
 #ifndef STATION_BASE_H
 #define STATION_BASE_H
 
+#include "core/flatmap_type.hpp"
 #include "core/flatset_type.hpp"
 #include "core/random_func.hpp"
 #include "base_station_base.h"
@@ -32,7 +33,7 @@ static const uint8_t MAX_STATION_RATING = 255;
  */
 class FlowStat {
 public:
-	typedef std::map<uint32_t, StationID> SharesMap;
+	typedef FlatMap<uint32_t, StationID> SharesMap;
 
 	static const SharesMap empty_sharesmap;
 
@@ -3973,6 +3973,28 @@ static void TruncateCargo(const CargoSpec *cs, GoodsEntry *ge, uint amount = UIN
 	}
 }
 
+/**
+ * Get the part of the rating of a cargo at a station that is replaced by the rating callback, if any.
+ * The comparisons add up to the rating without any branching on them.
+ * @param ge The goods entry to rate.
+ * @param last_vehicle_type Type of the last vehicle to visit the station.
+ * @return The rating based on the speed, the days since the last pickup and the cargo waiting.
+ */
+static inline int GetDefaultStationRating(const GoodsEntry &ge, uint8_t last_vehicle_type)
+{
+	int rating = std::max(ge.last_speed - 85, 0) >> 2;
+
+	uint8_t waittime = ge.time_since_pickup;
+	if (last_vehicle_type == VEH_SHIP) waittime >>= 2;
+	rating += (waittime <= 21) * 25 + (waittime <= 12) * 25 + (waittime <= 6) * 45 + (waittime <= 3) * 35;
+
+	rating -= 90;
+	uint waiting = ge.max_waiting_cargo;
+	rating += (waiting <= 1500) * 55 + (waiting <= 1000) * 35 + (waiting <= 600) * 10 + (waiting <= 300) * 20 + (waiting <= 100) * 10;
+
+	return rating;
+}
+
 /**
  * Periodic update of a station's rating.
  * @param st The station to update.
@@ -4051,24 +4073,7 @@ static void UpdateStationRating(Station *st)
 			}
 		}
 
-		if (!skip) {
-			int b = ge->last_speed - 85;
-			if (b >= 0) rating += b >> 2;
-
-			uint8_t waittime = ge->time_since_pickup;
-			if (st->last_vehicle_type == VEH_SHIP) waittime >>= 2;
-			if (waittime <= 21) rating += 25;
-			if (waittime <= 12) rating += 25;
-			if (waittime <= 6) rating += 45;
-			if (waittime <= 3) rating += 35;
-
-			rating -= 90;
-			if (ge->max_waiting_cargo <= 1500) rating += 55;
-			if (ge->max_waiting_cargo <= 1000) rating += 35;
-			if (ge->max_waiting_cargo <= 600) rating += 10;
-			if (ge->max_waiting_cargo <= 300) rating += 20;
-			if (ge->max_waiting_cargo <= 100) rating += 10;
-		}
+		if (!skip) rating += GetDefaultStationRating(*ge, st->last_vehicle_type);
 
 		if (Company::IsValidID(st->owner) && st->town->statues.Test(st->owner)) rating += 26;
 
@@ -4358,14 +4363,11 @@ void OnTick_Station()
 			DeleteStaleLinks(Station::From(st));
 		};
 
-		/* Spread out big-tick over STATION_ACCEPTANCE_TICKS ticks. */
+		/* Spread out big-tick and station animation over STATION_ACCEPTANCE_TICKS ticks. */
 		if ((TimerGameTick::counter + st->index) % Ticks::STATION_ACCEPTANCE_TICKS == 0) {
 			/* Stop processing this station if it was deleted */
 			if (!StationHandleBigTick(st)) continue;
-		}
 
-		/* Spread out station animation over STATION_ACCEPTANCE_TICKS ticks. */
-		if ((TimerGameTick::counter + st->index) % Ticks::STATION_ACCEPTANCE_TICKS == 0) {
 			TriggerStationAnimation(st, st->xy, StationAnimationTrigger::AcceptanceTick);
 			TriggerRoadStopAnimation(st, st->xy, StationAnimationTrigger::AcceptanceTick);
 			if (Station::IsExpected(st)) TriggerAirportAnimation(Station::From(st), AirportAnimationTrigger::AcceptanceTick);
@@ -5168,7 +5170,7 @@ void FlowStat::ReleaseShare(StationID st)
 	uint flow = 0;
 	uint next_share = 0;
 	bool found = false;
-	for (SharesMap::reverse_iterator it(this->shares.rbegin()); it != this->shares.rend(); ++it) {
+	for (SharesMap::const_reverse_iterator it(this->shares.rbegin()); it != this->shares.rend(); ++it) {
 		if (it->first < this->unrestricted) return; // Note: not <= as the share may hit the limit.
 		if (found) {
 			flow = next_share - it->first;
@@ -5183,7 +5185,7 @@ void FlowStat::ReleaseShare(StationID st)
 	if (flow == 0) return;
 	SharesMap new_shares;
 	new_shares[flow] = st;
-	for (SharesMap::iterator it(this->shares.begin()); it != this->shares.end(); ++it) {
+	for (SharesMap::const_iterator it(this->shares.begin()); it != this->shares.end(); ++it) {
 		if (it->second != st) {
 			new_shares[flow + it->first] = it->second;
 		} else {
@@ -2074,6 +2074,7 @@ bool ReadLanguagePack(const LanguageMetadata *lang)
 
 	/* Allocate offsets */
 	std::vector<std::string_view> strings;
+	strings.reserve(count);
 
 	/* Fill offsets */
 	char *s = lang_pack->data;
@@ -19,15 +19,17 @@
 #include "core/backup_type.hpp"
 #include "terraform_cmd.h"
 #include "landscape_cmd.h"
+#include "core/flatmap_type.hpp"
+#include "core/flatset_type.hpp"
 
 #include "table/strings.h"
 
 #include "safeguards.h"
 
-/** Set of tiles. */
-typedef std::set<TileIndex> TileIndexSet;
-/** Mapping of tiles to their height. */
-typedef std::map<TileIndex, int> TileIndexToHeightMap;
+/** Set of tiles. Kept sorted, so tiles are checked in the same order as always. */
+typedef FlatSet<TileIndex> TileIndexSet;
+/** Mapping of tiles to their height. Kept sorted, so heights are applied in the same order as always. */
+typedef FlatMap<TileIndex, int> TileIndexToHeightMap;
 
 /** State of the terraforming. */
 struct TerraformerState {
@@ -0,0 +1,166 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/**
+ * @file benchmarks.cpp Microbenchmarks for core containers and the sprite sorter.
+ *
+ * These are hidden test cases, so they are not run by ctest.
+ * Run them explicitly with: openttd_test "[benchmark]"
+ */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../core/kdtree.hpp"
+#include "../core/multimap.hpp"
+#include "../misc/lrucache.hpp"
+#include "../sortlist_type.h"
+#include "../viewport_sprite_sorter.h"
+
+#include "../safeguards.h"
+
+/** Benchmark points are packed as x * 65536 + y. */
+struct Kdtree_BenchXYFunc {
+	inline uint16_t operator()(uint32_t item, int dim) { return dim == 0 ? item >> 16 : item & 0xFFFF; }
+};
+
+using BenchKdtree = Kdtree<uint32_t, Kdtree_BenchXYFunc, uint16_t, int>;
+
+/** Pseudo random but reproducible points on a 4096x4096 map. */
+static std::vector<uint32_t> MakeBenchPoints(size_t count)
+{
+	std::vector<uint32_t> points;
+	uint32_t state = 12345;
+	while (points.size() < count) {
+		state = state * 1103515245 + 12345;
+		points.push_back(((state >> 8) & 0x0FFF) << 16 | ((state >> 20) & 0x0FFF));
+	}
+	std::sort(points.begin(), points.end());
+	points.erase(std::unique(points.begin(), points.end()), points.end());
+	return points;
+}
+
+TEST_CASE("Kdtree", "[.][benchmark]")
+{
+	const std::vector<uint32_t> points = MakeBenchPoints(10000);
+
+	BENCHMARK("Build 10000")
+	{
+		/* Build reorders the elements it is given. */
+		std::vector<uint32_t> elements = points;
+		BenchKdtree tree;
+		tree.Build(elements.begin(), elements.end());
+		return tree.Count();
+	};
+
+	BENCHMARK("Insert 10000 in order")
+	{
+		BenchKdtree tree;
+		for (uint32_t p : points) tree.Insert(p);
+		return tree.Count();
+	};
+
+	std::vector<uint32_t> elements = points;
+	BenchKdtree tree;
+	tree.Build(elements.begin(), elements.end());
+
+	BENCHMARK("FindContained 64x64")
+	{
+		size_t found = 0;
+		for (uint16_t x = 0; x < 4096 - 64; x += 256) {
+			tree.FindContained(x, x, x + 64, x + 64, [&found](uint32_t) { found++; });
+		}
+		return found;
+	};
+
+	BENCHMARK("FindNearest")
+	{
+		uint32_t sum = 0;
+		for (uint16_t x = 0; x < 4096; x += 64) sum += tree.FindNearest(x, 4095 - x);
+		return sum;
+	};
+}
+
+TEST_CASE("GUIList sort", "[.][benchmark]")
+{
+	GUIList<uint32_t> list;
+	auto compare = [](const uint32_t &a, const uint32_t &b) { return a < b; };
+	for (uint32_t p : MakeBenchPoints(2000)) list.push_back(p);
+	std::reverse(list.begin(), list.end());
+
+	BENCHMARK("Resort sorted 2000")
+	{
+		list.ForceResort();
+		return list.Sort(compare);
+	};
+
+	BENCHMARK_ADVANCED("Resort with one changed item 2000")(Catch::Benchmark::Chronometer meter)
+	{
+		list.ForceResort();
+		list.Sort(compare);
+		/* Give every run its own sorted list with only the last item changed. */
+		std::vector<GUIList<uint32_t>> lists(meter.runs(), list);
+		for (auto &l : lists) l.back() = 0;
+		meter.measure([&](int i) {
+			lists[i].ForceResort();
+			return lists[i].Sort(compare);
+		});
+	};
+}
+
+TEST_CASE("LRUCache", "[.][benchmark]")
+{
+	LRUCache<uint32_t, uint32_t> cache(1024);
+
+	BENCHMARK("Insert and get 4096")
+	{
+		uint32_t sum = 0;
+		for (uint32_t i = 0; i < 4096; i++) {
+			cache.Insert(i % 1500, uint32_t{i});
+			if (cache.Contains(i / 2)) sum += cache.Get(i / 2);
+		}
+		return sum;
+	};
+}
+
+TEST_CASE("MultiMap", "[.][benchmark]")
+{
+	using BenchMultiMap = MultiMap<uint32_t, uint32_t, std::less<uint32_t>>;
+	BenchMultiMap map;
+	for (uint32_t i = 0; i < 10000; i++) map.Insert(i % 500, i);
+
+	BENCHMARK("Iterate 10000")
+	{
+		uint32_t sum = 0;
+		for (BenchMultiMap::iterator it(map.begin()); it != map.end(); ++it) sum += *it;
+		return sum;
+	};
+}
+
+TEST_CASE("ParentSpriteList", "[.][benchmark]")
+{
+	/* A typical zoomed out viewport has a few thousand parent sprites. */
+	std::vector<ParentSpriteToDraw> sprites(5000);
+	ParentSpriteToSortVector psdv;
+	uint32_t i = 0;
+	for (uint32_t p : MakeBenchPoints(sprites.size())) {
+		ParentSpriteToDraw &ps = sprites[i++];
+		ps.xmin = (p >> 16) * 16;
+		ps.ymin = (p & 0xFFFF) * 16;
+		psdv.push_back(&ps);
+	}
+
+	ParentSpriteList list;
+	BENCHMARK("Reset and walk 5000")
+	{
+		list.Reset(psdv);
+		int64_t sum = 0;
+		for (uint32_t x = list.Next(ParentSpriteList::BEFORE_BEGIN); x != ParentSpriteList::END; x = list.Next(x)) sum += list.Key(x);
+		return sum;
+	};
+}
@@ -0,0 +1,65 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file flatmap_type.cpp Test functionality from core/flatmap_type. */
+
+#include "../stdafx.h"
+
+#include <ranges>
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../core/flatmap_type.hpp"
+
+#include "../safeguards.h"
+
+TEST_CASE("FlatMap - basic")
+{
+	FlatMap<uint32_t, uint8_t> map;
+
+	/* Map should be empty. */
+	CHECK(map.empty());
+	CHECK(map.upper_bound(0) == map.end());
+
+	/* Insert in a random order. */
+	map[20] = 2;
+	map[10] = 1;
+	map[40] = 4;
+	map[30] = 3;
+	CHECK(map.size() == 4);
+
+	std::vector<std::pair<uint32_t, uint8_t>> expected = {{10, 1}, {20, 2}, {30, 3}, {40, 4}};
+	CHECK(std::ranges::equal(map, expected));
+	CHECK(std::ranges::equal(std::ranges::subrange(map.rbegin(), map.rend()), expected | std::views::reverse));
+
+	/* Assigning an existing key replaces its value. */
+	map[20] = 5;
+	CHECK(map.size() == 4);
+	CHECK(map.upper_bound(19)->second == 5);
+
+	/* find only finds existing keys. */
+	CHECK(map.find(30)->second == 3);
+	CHECK(map.find(10) == map.begin());
+	CHECK(map.find(25) == map.end());
+	CHECK(map.find(50) == map.end());
+
+	/* upper_bound finds the first key greater than the given one. */
+	CHECK(map.upper_bound(0)->first == 10);
+	CHECK(map.upper_bound(10)->first == 20);
+	CHECK(map.upper_bound(39)->first == 40);
+	CHECK(map.upper_bound(40) == map.end());
+
+	/* Swapping exchanges the contents. */
+	FlatMap<uint32_t, uint8_t> other;
+	other[1] = 1;
+	map.swap(other);
+	CHECK(map.size() == 1);
+	CHECK(other.size() == 4);
+
+	map.clear();
+	CHECK(map.empty());
+}
@@ -0,0 +1,77 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file kdtree.cpp Test functionality from core/kdtree. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#define KDTREE_DEBUG
+#include "../core/kdtree.hpp"
+
+#include "../safeguards.h"
+
+/** Test points are packed as x * 256 + y. */
+struct Kdtree_TestXYFunc {
+	inline uint16_t operator()(uint16_t item, int dim) { return dim == 0 ? item >> 8 : item & 0xFF; }
+};
+
+using TestKdtree = Kdtree<uint16_t, Kdtree_TestXYFunc, uint16_t, int>;
+
+static std::vector<uint16_t> FindContainedSorted(const TestKdtree &tree, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	std::vector<uint16_t> result = tree.FindContained(x1, y1, x2, y2);
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+TEST_CASE("Kdtree - sorted inserts stay searchable")
+{
+	TestKdtree tree;
+	std::vector<uint16_t> inserted;
+
+	/* Inserting along a diagonal in order is the worst case for an unbalanced tree. */
+	for (uint16_t i = 0; i < 200; i++) {
+		uint16_t item = (i << 8) | i;
+		tree.Insert(item);
+		inserted.push_back(item);
+	}
+	CHECK(tree.Count() == inserted.size());
+	CHECK(FindContainedSorted(tree, 0, 0, 255, 255) == inserted);
+	CHECK(FindContainedSorted(tree, 10, 10, 13, 13) == std::vector<uint16_t>{(10 << 8) | 10, (11 << 8) | 11, (12 << 8) | 12});
+	CHECK(tree.FindNearest(100, 101) == ((100 << 8) | 100));
+
+	/* Remove every other element. */
+	for (uint16_t i = 0; i < 200; i += 2) tree.Remove((i << 8) | i);
+	std::erase_if(inserted, [](uint16_t item) { return (item & 1) == 0; });
+	CHECK(tree.Count() == inserted.size());
+	CHECK(FindContainedSorted(tree, 0, 0, 255, 255) == inserted);
+	CHECK(tree.FindNearest(100, 100) == ((99 << 8) | 99));
+}
+
+TEST_CASE("Kdtree - inserts after build")
+{
+	std::vector<uint16_t> items;
+	for (uint16_t x = 0; x < 16; x++) {
+		for (uint16_t y = 0; y < 16; y++) items.push_back((x << 8) | y);
+	}
+
+	TestKdtree tree;
+	tree.Build(items.begin(), items.end());
+
+	/* Add a dense column next to the built grid. */
+	for (uint16_t y = 0; y < 100; y++) {
+		tree.Insert((20 << 8) | y);
+		items.push_back((20 << 8) | y);
+	}
+	std::sort(items.begin(), items.end());
+
+	CHECK(tree.Count() == items.size());
+	CHECK(FindContainedSorted(tree, 0, 0, 255, 255) == items);
+	CHECK(FindContainedSorted(tree, 20, 50, 21, 52) == std::vector<uint16_t>{(20 << 8) | 50, (20 << 8) | 51});
+}
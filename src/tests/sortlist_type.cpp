@@ -0,0 +1,57 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file sortlist_type.cpp Test functionality from sortlist_type.h. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../sortlist_type.h"
+
+#include "../safeguards.h"
+
+static bool IntSorter(const int &a, const int &b)
+{
+	return a < b;
+}
+
+/** Resort the list and check it matches a full sort of the same items. */
+static void CheckResort(GUIList<int> &list)
+{
+	std::vector<int> expected(list.begin(), list.end());
+	std::sort(expected.begin(), expected.end());
+
+	list.ForceResort();
+	list.Sort(&IntSorter);
+	CHECK(std::vector<int>(list.begin(), list.end()) == expected);
+}
+
+TEST_CASE("GUIList - resort after changes")
+{
+	GUIList<int> list;
+	for (int i = 0; i < 100; i++) list.push_back(i * 10);
+	CheckResort(list);
+
+	/* Items that move forward, like a growing town in a descending list. */
+	list[50] = 5;
+	list[80] = 15;
+	CheckResort(list);
+
+	/* An item that moves backward drags the items after it out of place. */
+	list[10] = 2000;
+	CheckResort(list);
+
+	/* Items appended at the end. */
+	list.push_back(-1);
+	list.push_back(500);
+	list.push_back(500);
+	CheckResort(list);
+
+	std::reverse(list.begin(), list.end());
+	CheckResort(list);
+}
@@ -0,0 +1,55 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file viewport_sprite_sorter.cpp Test functionality from viewport_sprite_sorter. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../viewport_sprite_sorter.h"
+
+#include "../safeguards.h"
+
+TEST_CASE("ParentSpriteList - ordered by xmin + ymin")
+{
+	std::array<ParentSpriteToDraw, 4> sprites{};
+	sprites[0].xmin = 32; sprites[0].ymin = 16;
+	sprites[1].xmin = 0;  sprites[1].ymin = 0;
+	sprites[2].xmin = 16; sprites[2].ymin = 48;
+	sprites[3].xmin = 8;  sprites[3].ymin = 8;
+
+	ParentSpriteToSortVector psdv;
+	for (auto &p : sprites) psdv.push_back(&p);
+
+	ParentSpriteList list;
+	list.Reset(psdv);
+
+	std::vector<ParentSpriteToDraw *> order;
+	for (uint32_t x = list.Next(ParentSpriteList::BEFORE_BEGIN); x != ParentSpriteList::END; x = list.Next(x)) {
+		CHECK(list.Key(x) == list.Sprite(x)->xmin + list.Sprite(x)->ymin);
+		order.push_back(list.Sprite(x));
+	}
+	CHECK(order == std::vector<ParentSpriteToDraw *>{&sprites[1], &sprites[3], &sprites[0], &sprites[2]});
+
+	/* Remove the first and a middle node. */
+	uint32_t first = list.Next(ParentSpriteList::BEFORE_BEGIN);
+	uint32_t after_erased = list.EraseAfter(ParentSpriteList::BEFORE_BEGIN);
+	CHECK(after_erased == list.Next(ParentSpriteList::BEFORE_BEGIN));
+	CHECK(list.Sprite(list.Next(ParentSpriteList::BEFORE_BEGIN)) == &sprites[3]);
+	uint32_t second = list.Next(ParentSpriteList::BEFORE_BEGIN);
+	list.EraseAfter(second);
+	CHECK(list.Sprite(list.Next(second)) == &sprites[2]);
+	CHECK(list.Next(list.Next(second)) == ParentSpriteList::END);
+	CHECK(first != second);
+
+	/* Refilling reuses the list. */
+	psdv.resize(1);
+	list.Reset(psdv);
+	CHECK(list.Sprite(list.Next(ParentSpriteList::BEFORE_BEGIN)) == &sprites[0]);
+	CHECK(list.Next(list.Next(ParentSpriteList::BEFORE_BEGIN)) == ParentSpriteList::END);
+}
@@ -82,10 +82,6 @@ uint days_in_month[] = {31, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};//CB
 void CB_UpdateTownStorage(Town *t); //CB
 
 
-namespace citymania {
-	extern TileIndex _closest_cache_ref;
-}
-
 /* Initialize the town-pool */
 TownPool _town_pool("Town");
 INSTANTIATE_POOL_METHODS(Town)
@@ -2414,7 +2410,6 @@ static void DoCreateTown(Town *t, TileIndex tile, uint32_t townnameparts, TownSi
 	InvalidateWindowData(WC_TOWN_DIRECTORY, 0, TDIWD_FORCE_REBUILD);
 
 	t->cache.num_houses -= x;
-	citymania::_closest_cache_ref = INVALID_TILE;
 	UpdateTownRadius(t);
 	UpdateTownGrowthRate(t);
 	UpdateTownMaxPass(t);
@@ -381,11 +381,12 @@ Vehicle::Vehicle(VehicleType type)
 }
 
 /* Size of the hash, 6 = 64 x 64, 7 = 128 x 128. Larger sizes will (in theory) reduce hash
- * lookup times at the expense of memory usage. */
-constexpr uint TILE_HASH_BITS = 7;
-constexpr uint TILE_HASH_SIZE = 1 << TILE_HASH_BITS;
-constexpr uint TILE_HASH_MASK = TILE_HASH_SIZE - 1;
-constexpr uint TOTAL_TILE_HASH_SIZE = 1 << (TILE_HASH_BITS * 2);
+ * lookup times at the expense of memory usage. The actual size depends on the map size,
+ * so large maps do not end up with many unrelated tiles in each bucket. */
+constexpr uint MIN_TILE_HASH_BITS = 7;
+constexpr uint MAX_TILE_HASH_BITS = 9;
+static uint _tile_hash_bits = MIN_TILE_HASH_BITS;
+static uint _tile_hash_mask = (1U << MIN_TILE_HASH_BITS) - 1;
 
 /* Resolution of the hash, 0 = 1*1 tile, 1 = 2*2 tiles, 2 = 4*4 tiles, etc.
  * Profiling results show that 0 is fastest. */
@@ -396,7 +397,7 @@ constexpr uint TILE_HASH_RES = 0;
  */
 static inline uint GetTileHash1D(uint p)
 {
-	return GB(p, TILE_HASH_RES, TILE_HASH_BITS);
+	return GB(p, TILE_HASH_RES, _tile_hash_bits);
 }
 
 /**
@@ -404,7 +405,7 @@ static inline uint GetTileHash1D(uint p)
  */
 static inline uint IncTileHash1D(uint h)
 {
-	return (h + 1) & TILE_HASH_MASK;
+	return (h + 1) & _tile_hash_mask;
 }
 
 /**
@@ -412,7 +413,7 @@ static inline uint IncTileHash1D(uint h)
  */
 static inline uint ComposeTileHash(uint hx, uint hy)
 {
-	return hx | hy << TILE_HASH_BITS;
+	return hx | hy << _tile_hash_bits;
 }
 
 /**
@@ -423,7 +424,7 @@ static inline uint GetTileHash(uint x, uint y)
 	return ComposeTileHash(GetTileHash1D(x), GetTileHash1D(y));
 }
 
-static std::array<Vehicle *, TOTAL_TILE_HASH_SIZE> _vehicle_tile_hash{};
+static std::vector<Vehicle *> _vehicle_tile_hash(1U << (MIN_TILE_HASH_BITS * 2));
 
 /**
  * Iterator constructor.
@@ -437,7 +438,7 @@ VehiclesNearTileXY::Iterator::Iterator(int32_t x, int32_t y, uint max_dist)
 	this->pos_rect.top = std::max<int>(0, y - max_dist);
 	this->pos_rect.bottom = std::max<int>(0, y + max_dist);
 
-	if (2 * max_dist < TILE_HASH_MASK * TILE_SIZE) {
+	if (2 * max_dist < _tile_hash_mask * TILE_SIZE) {
 		/* Hash area to scan */
 		this->hxmin = this->hx = GetTileHash1D(this->pos_rect.left / TILE_SIZE);
 		this->hxmax = GetTileHash1D(this->pos_rect.right / TILE_SIZE);
@@ -446,9 +447,9 @@ VehiclesNearTileXY::Iterator::Iterator(int32_t x, int32_t y, uint max_dist)
 	} else {
 		/* Scan all */
 		this->hxmin = this->hx = 0;
-		this->hxmax = TILE_HASH_MASK;
+		this->hxmax = _tile_hash_mask;
 		this->hymin = this->hy = 0;
-		this->hymax = TILE_HASH_MASK;
+		this->hymax = _tile_hash_mask;
 	}
 
 	this->current_veh = _vehicle_tile_hash[ComposeTileHash(this->hx, this->hy)];
@@ -650,7 +651,19 @@ void ResetVehicleHash()
 {
 	for (Vehicle *v : Vehicle::Iterate()) { v->hash_tile_current = nullptr; }
 	_vehicle_viewport_hash.fill(nullptr);
-	_vehicle_tile_hash.fill(nullptr);
+	std::ranges::fill(_vehicle_tile_hash, nullptr);
+}
+
+/**
+ * Size the vehicle tile hash for the current map size.
+ * Must be called whenever the map is (re)allocated.
+ */
+void AllocateVehicleTileHash()
+{
+	_tile_hash_bits = Clamp(std::max(Map::LogX(), Map::LogY()), MIN_TILE_HASH_BITS, MAX_TILE_HASH_BITS);
+	_tile_hash_mask = (1U << _tile_hash_bits) - 1;
+	_vehicle_tile_hash.assign(1U << (_tile_hash_bits * 2), nullptr);
+	for (Vehicle *v : Vehicle::Iterate()) { v->hash_tile_current = nullptr; }
 }
 
 void ResetVehicleColourMap()
@@ -189,6 +189,7 @@ uint8_t CalcPercentVehicleFilled(const Vehicle *v, StringID *colour);
 void VehicleLengthChanged(const Vehicle *u);
 
 void ResetVehicleHash();
+void AllocateVehicleTileHash();
 void ResetVehicleColourMap();
 
 uint8_t GetBestFittingSubType(Vehicle *v_from, Vehicle *v_for, CargoType dest_cargo_type);
@@ -15,9 +15,12 @@
 #include "../saveload/saveload.h"
 #include "../window_func.h"
 #include "null_v.h"
+#include "../citymania/cm_console_cmds.hpp"
 
 #include "../safeguards.h"
 
+extern void ConPrintFramerate(); // framerate_gui.cpp
+
 /** Factory for the null video driver. */
 static FVideoDriver_Null iFVideoDriver_Null;
 
@@ -35,6 +38,7 @@ std::optional<std::string_view> VideoDriver_Null::Start(const StringList &parm)
 	this->ticks = GetDriverParamInt(parm, "ticks", 1000);
 	auto saveptr = GetDriverParam(parm, "save");
 	this->savefile = saveptr.value_or("");
+	this->print_framerate = GetDriverParamBool(parm, "framerate");
 	_screen.width  = _screen.pitch = _cur_resolution.width;
 	_screen.height = _cur_resolution.height;
 	_screen.dst_ptr = nullptr;
@@ -55,6 +59,7 @@ void VideoDriver_Null::MainLoop()
 	uint i;
 
 	TimerGameTick::TickCounter old_tick;
+	auto start_time = std::chrono::steady_clock::now();
 	for (i = 0; i < this->ticks; ) {
 		old_tick = TimerGameTick::counter;
 		::GameLoop();
@@ -63,7 +68,11 @@ void VideoDriver_Null::MainLoop()
 		if (old_tick != TimerGameTick::counter) i++;
 		else _pause_mode = {};
 	}
-	IConsolePrint(CC_DEFAULT, "Null driver ran for {} tics, save: {}", this->ticks, this->savefile);
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+	IConsolePrint(CC_DEFAULT, "Null driver ran for {} tics in {:.2f} seconds ({:.0f} tics/s), save: {}",
+		this->ticks, elapsed.count(), elapsed.count() > 0 ? this->ticks / elapsed.count() : 0.0, this->savefile);
+	citymania::PrintReplayStatistics();
+	if (this->print_framerate) ConPrintFramerate();
 	if (!this->savefile.empty()) {
 	    if (SaveOrLoad(this->savefile.c_str(), SLO_SAVE, DFT_GAME_FILE, SAVE_DIR) != SL_OK) {
 	        IConsolePrint(CC_ERROR, "Error saving the final game state.");
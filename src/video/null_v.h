@@ -17,6 +17,7 @@ class VideoDriver_Null : public VideoDriver {
 private:
 	uint ticks = 0; ///< Amount of ticks to run.
 	std::string savefile;
+	bool print_framerate = false; ///< Print the framerate measurements after running.
 
 public:
 	std::optional<std::string_view> Start(const StringList &param) override;
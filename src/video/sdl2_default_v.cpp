@@ -88,6 +88,30 @@ void VideoDriver_SDL_Default::MakePalette()
 	}
 }
 
+void VideoDriver_SDL_Default::MakeDirty(int left, int top, int width, int height)
+{
+	this->VideoDriver_SDL_Base::MakeDirty(left, top, width, height);
+
+	/* Grow a dirty area that is close by, so neighbouring dirty blocks end up as one rectangle. */
+	Rect r = {left, top, left + width, top + height};
+	for (Rect &d : this->dirty_rects) {
+		if (r.left <= d.right + DIRTY_RECT_MERGE_DISTANCE && d.left <= r.right + DIRTY_RECT_MERGE_DISTANCE &&
+				r.top <= d.bottom + DIRTY_RECT_MERGE_DISTANCE && d.top <= r.bottom + DIRTY_RECT_MERGE_DISTANCE) {
+			d = BoundingRect(d, r);
+			return;
+		}
+	}
+
+	if (this->dirty_rects.size() < MAX_DIRTY_RECTS) {
+		this->dirty_rects.push_back(r);
+		return;
+	}
+
+	/* Too many separate areas, just update everything that is dirty at once. */
+	this->dirty_rects.clear();
+	this->dirty_rects.push_back(this->dirty_rect);
+}
+
 void VideoDriver_SDL_Default::Paint()
 {
 	PerformanceMeasurer framerate(PFE_VIDEO);
@@ -116,14 +140,20 @@ void VideoDriver_SDL_Default::Paint()
 		this->local_palette.count_dirty = 0;
 	}
 
-	SDL_Rect r = { this->dirty_rect.left, this->dirty_rect.top, this->dirty_rect.right - this->dirty_rect.left, this->dirty_rect.bottom - this->dirty_rect.top };
+	std::array<SDL_Rect, MAX_DIRTY_RECTS> rects;
+	size_t count = 0;
+	for (const Rect &d : this->dirty_rects) {
+		SDL_Rect &r = rects[count++];
+		r = { d.left, d.top, d.right - d.left, d.bottom - d.top };
 
-	if (_sdl_surface != _sdl_real_surface) {
-		SDL_BlitSurface(_sdl_surface, &r, _sdl_real_surface, &r);
+		if (_sdl_surface != _sdl_real_surface) {
+			SDL_BlitSurface(_sdl_surface, &r, _sdl_real_surface, &r);
+		}
 	}
-	SDL_UpdateWindowSurfaceRects(this->sdl_window, &r, 1);
+	SDL_UpdateWindowSurfaceRects(this->sdl_window, rects.data(), static_cast<int>(count));
 
 	this->dirty_rect = {};
+	this->dirty_rects.clear();
 }
 
 bool VideoDriver_SDL_Default::AllocateBackingStore(int w, int h, bool force)
@@ -156,6 +186,7 @@ bool VideoDriver_SDL_Default::AllocateBackingStore(int w, int h, bool force)
 	 * will mark the whole screen dirty again anyway, but this time with the
 	 * new dimensions. */
 	this->dirty_rect = {};
+	this->dirty_rects.clear();
 
 	_screen.width = _sdl_surface->w;
 	_screen.height = _sdl_surface->h;
@@ -17,6 +17,8 @@ class VideoDriver_SDL_Default : public VideoDriver_SDL_Base {
 public:
 	std::string_view GetName() const override { return "sdl"; }
 
+	void MakeDirty(int left, int top, int width, int height) override;
+
 protected:
 	bool AllocateBackingStore(int w, int h, bool force = false) override;
 	void *GetVideoPointer() override;
@@ -25,6 +27,11 @@ protected:
 	void ReleaseVideoPointer() override {}
 
 private:
+	static constexpr size_t MAX_DIRTY_RECTS = 16; ///< Number of separate dirty areas before they are all merged into one.
+	static constexpr int DIRTY_RECT_MERGE_DISTANCE = 32; ///< Dirty areas closer than this many pixels are merged.
+
+	std::vector<Rect> dirty_rects{}; ///< Separate dirty areas of the video buffer, all within #dirty_rect.
+
 	void UpdatePalette();
 	void MakePalette();
 };
@@ -93,7 +93,6 @@
 #include "framerate_type.h"
 #include "viewport_cmd.h"
 
-#include <forward_list>
 #include <stack>
 
 #include "widgets/vehicle_widget.h"
@@ -105,6 +104,7 @@
 /* CityMania code start */
 #include "math.h"
 #include "core/math_func.hpp"
+#include "citymania/cm_export.hpp"
 #include "citymania/cm_highlight.hpp"
 #include "citymania/cm_hotkeys.hpp"
 #include "citymania/cm_town_gui.hpp"
@@ -1308,10 +1308,8 @@ static void ViewportAddLandscape()
 	bool last_row = false;
 	for (; !last_row; row++) {
 		last_row = true;
-		for (int column = left_column; column <= right_column; column++) {
-			/* Valid row/column? */
-			if ((row + column) % 2 != 0) continue;
-
+		/* Only (row, column) pairs that are both even or both odd are valid, so skip the others right away. */
+		for (int column = left_column + ((row + left_column) & 1); column <= right_column; column += 2) {
 			Point tilecoord;
 			tilecoord.x = (row - column) / 2;
 			tilecoord.y = (row + column) / 2;
@@ -1357,7 +1355,7 @@ static void ViewportAddLandscape()
 
 				if (IsBridgeAbove(_cur_ti.tile)) {
 					/* Is the bridge visible? */
-					TileIndex bridge_tile = GetNorthernBridgeEnd(_cur_ti.tile);
+					TileIndex bridge_tile = GetCachedBridgeEnds(_cur_ti.tile).first;
 					int bridge_height = ZOOM_BASE * (GetBridgePixelHeight(bridge_tile) - TilePixelHeight(_cur_ti.tile));
 					if (min_visible_height < bridge_height + MAX_TILE_EXTENT_TOP) tile_visible = true;
 				}
@@ -1535,10 +1533,14 @@ static void ViewportAddKdtreeSigns(DrawPixelInfo *dpi)
 	bool show_signs = HasBit(_display_opt, DO_SHOW_SIGNS) && !IsInvisibilitySet(TO_SIGNS);
 	bool show_competitors = HasBit(_display_opt, DO_SHOW_COMPETITOR_SIGNS);
 
-	/* Collect all the items first and draw afterwards, to ensure layering */
-	std::vector<const BaseStation *> stations;
-	std::vector<const Town *> towns;
-	std::vector<const Sign *> signs;
+	/* Collect all the items first and draw afterwards, to ensure layering.
+	 * This is called for every dirty part of every viewport, so keep the storage around. */
+	static std::vector<const BaseStation *> stations;
+	static std::vector<const Town *> towns;
+	static std::vector<const Sign *> signs;
+	stations.clear();
+	towns.clear();
+	signs.clear();
 
 	_viewport_sign_kdtree.FindContained(search_rect.left, search_rect.top, search_rect.right, search_rect.bottom, [&](const ViewportSignKdtreeItem & item) {
 		switch (item.type) {
@@ -1690,22 +1692,20 @@ static void ViewportSortParentSprites(ParentSpriteToSortVector *psdv)
 	 */
 	const uint32_t ORDER_COMPARED = UINT32_MAX; // Sprite was compared but we still need to compare the ones preceding it
 	const uint32_t ORDER_RETURNED = UINT32_MAX - 1; // Mark sorted sprite in case there are other occurrences of it in the stack
-	std::stack<ParentSpriteToDraw *> sprite_order;
+	std::stack<ParentSpriteToDraw *, std::vector<ParentSpriteToDraw *>> sprite_order;
 	uint32_t next_order = 0;
 
-	std::forward_list<std::pair<int64_t, ParentSpriteToDraw *>> sprite_list;  // We store sprites in a list sorted by xmin+ymin
+	static ParentSpriteList sprite_list;  // We store sprites in a list sorted by xmin+ymin
 
 	/* Initialize sprite list and order. */
+	sprite_list.Reset(*psdv);
 	for (auto p = psdv->rbegin(); p != psdv->rend(); p++) {
-		sprite_list.emplace_front((*p)->xmin + (*p)->ymin, *p);
 		sprite_order.push(*p);
 		(*p)->order = next_order++;
 	}
 
-	sprite_list.sort();
-
 	std::vector<ParentSpriteToDraw *> preceding;  // Temporarily stores sprites that precede current and their position in the list
-	auto preceding_prev = sprite_list.begin(); // Store iterator in case we need to delete a single preceding sprite
+	uint32_t preceding_prev = ParentSpriteList::BEFORE_BEGIN; // Store node in case we need to delete a single preceding sprite
 	auto out = psdv->begin();  // Iterator to output sorted sprites
 
 	while (!sprite_order.empty()) {
@@ -1734,18 +1734,19 @@ static void ViewportSortParentSprites(ParentSpriteToSortVector *psdv)
 		 * to ensure that we iterate the current sprite as we need to remove it from the list.
 		 */
 		auto ssum = std::max(s->xmax, s->xmin) + std::max(s->ymax, s->ymin);
-		auto prev = sprite_list.before_begin();
-		auto x = sprite_list.begin();
-		while (x != sprite_list.end() && x->first <= ssum) {
-			auto p = x->second;
+		uint32_t prev = ParentSpriteList::BEFORE_BEGIN;
+		uint32_t x = sprite_list.Next(prev);
+		while (x != ParentSpriteList::END && sprite_list.Key(x) <= ssum) {
+			auto p = sprite_list.Sprite(x);
 			if (p == s) {
 				/* We found the current sprite, remove it and move on. */
-				x = sprite_list.erase_after(prev);
+				x = sprite_list.EraseAfter(prev);
 				continue;
 			}
 
 			auto p_prev = prev;
-			prev = x++;
+			prev = x;
+			x = sprite_list.Next(x);
 
 			if (s->xmax < p->xmin || s->ymax < p->ymin || s->zmax < p->zmin) continue;
 			if (s->xmin <= p->xmax && // overlap in X?
@@ -1774,7 +1775,7 @@ static void ViewportSortParentSprites(ParentSpriteToSortVector *psdv)
 			if (p->xmax <= s->xmax && p->ymax <= s->ymax && p->zmax <= s->zmax) {
 				p->order = ORDER_RETURNED;
 				s->order = ORDER_RETURNED;
-				sprite_list.erase_after(preceding_prev);
+				sprite_list.EraseAfter(preceding_prev);
 				*(out++) = p;
 				*(out++) = s;
 				continue;
@@ -1912,6 +1913,8 @@ void ViewportDoDraw(const Viewport &vp, int left, int top, int right, int bottom
 	_vd.dpi.dst_ptr = BlitterFactory::GetCurrentBlitter()->MoveTo(_cur_dpi->dst_ptr, x - _cur_dpi->left, y - _cur_dpi->top);
 	AutoRestoreBackup dpi_backup(_cur_dpi, &_vd.dpi);
 
+	/* The map may have changed since the previous draw. */
+	InvalidateCachedBridgeEnds();
 	ViewportAddLandscape();
 	ViewportAddVehicles(&_vd.dpi);
 
@@ -1921,6 +1924,7 @@ void ViewportDoDraw(const Viewport &vp, int left, int top, int right, int bottom
 
 	if (!_vd.tile_sprites_to_draw.empty()) ViewportDrawTileSprites(&_vd.tile_sprites_to_draw);
 
+	_vd.parent_sprites_to_sort.reserve(_vd.parent_sprites_to_draw.size());
 	for (auto &psd : _vd.parent_sprites_to_draw) {
 		_vd.parent_sprites_to_sort.push_back(&psd);
 	}
@@ -2281,6 +2285,7 @@ void ConstrainAllViewportsZoom()
  */
 void MarkTileDirtyByTile(TileIndex tile, int bridge_level_offset, int tile_height_override)
 {
+	citymania::MarkWorldTileDirty(tile);
 	Point pt = RemapCoords(TileX(tile) * TILE_SIZE, TileY(tile) * TILE_SIZE, tile_height_override * TILE_HEIGHT);
 	MarkAllViewportsDirty(
 			pt.x - MAX_TILE_EXTENT_LEFT,
@@ -4153,18 +4158,39 @@ void ResetObjectToPlace()
 	citymania::ResetActiveTool();
 }
 
-Point GetViewportStationMiddle(const Viewport &vp, const Station *st)
+/**
+ * Get the middle of a station in the virtual coordinates of viewports.
+ * @param st Station to get the middle of.
+ * @return The middle of the station, independent of any viewport.
+ */
+Point GetStationVirtualMiddle(const Station *st)
 {
 	int x = TileX(st->xy) * TILE_SIZE;
 	int y = TileY(st->xy) * TILE_SIZE;
 	int z = GetSlopePixelZ(Clamp(x, 0, Map::SizeX() * TILE_SIZE - 1), Clamp(y, 0, Map::SizeY() * TILE_SIZE - 1));
 
-	Point p = RemapCoords(x, y, z);
-	p.x = UnScaleByZoom(p.x - vp.virtual_left, vp.zoom) + vp.left;
-	p.y = UnScaleByZoom(p.y - vp.virtual_top, vp.zoom) + vp.top;
+	return RemapCoords(x, y, z);
+}
+
+/**
+ * Get the screen position of the middle of a station in a viewport.
+ * @param vp The viewport.
+ * @param virtual_middle Middle of the station, as returned by GetStationVirtualMiddle().
+ * @return The position in the viewport.
+ */
+Point GetViewportStationMiddle(const Viewport &vp, Point virtual_middle)
+{
+	Point p;
+	p.x = UnScaleByZoom(virtual_middle.x - vp.virtual_left, vp.zoom) + vp.left;
+	p.y = UnScaleByZoom(virtual_middle.y - vp.virtual_top, vp.zoom) + vp.top;
 	return p;
 }
 
+Point GetViewportStationMiddle(const Viewport &vp, const Station *st)
+{
+	return GetViewportStationMiddle(vp, GetStationVirtualMiddle(st));
+}
+
 /** Helper class for getting the best sprite sorter. */
 struct ViewportSSCSS {
 	VpSorterChecker fct_checker; ///< The check function.
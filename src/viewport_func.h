@@ -98,6 +98,8 @@ inline void MarkTileDirtyByTile(TileIndex tile, int bridge_level_offset = 0)
 	MarkTileDirtyByTile(tile, bridge_level_offset, TileHeight(tile));
 }
 
+Point GetStationVirtualMiddle(const Station *st);
+Point GetViewportStationMiddle(const Viewport &vp, Point virtual_middle);
 Point GetViewportStationMiddle(const Viewport &vp, const Station *st);
 
 struct Station;
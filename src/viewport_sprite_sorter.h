@@ -39,6 +39,53 @@ struct ParentSpriteToDraw {
 
 typedef std::vector<ParentSpriteToDraw*> ParentSpriteToSortVector;
 
+/**
+ * Parent sprites ordered by xmin + ymin, as used by the sprite sorters.
+ * This is a singly linked list whose nodes are kept in one vector, so
+ * filling it does not allocate for every sprite and walking it stays
+ * cache friendly even for the huge amount of sprites in zoomed out views.
+ */
+class ParentSpriteList {
+public:
+	static constexpr uint32_t BEFORE_BEGIN = 0; ///< Node before the first sprite in the list.
+	static constexpr uint32_t END = UINT32_MAX; ///< Node after the last sprite in the list.
+
+	/**
+	 * Fill the list with the given sprites, reusing the storage of earlier calls.
+	 * @param psdv The sprites to put into the list.
+	 */
+	void Reset(const ParentSpriteToSortVector &psdv)
+	{
+		this->items.clear();
+		this->items.emplace_back(INT64_MIN, nullptr);
+		for (ParentSpriteToDraw *p : psdv) this->items.emplace_back(p->xmin + p->ymin, p);
+		std::sort(this->items.begin() + 1, this->items.end());
+
+		this->next.resize(this->items.size());
+		for (uint32_t i = 0; i < this->next.size(); i++) this->next[i] = i + 1;
+		this->next.back() = END;
+	}
+
+	inline uint32_t Next(uint32_t node) const { return this->next[node]; }
+	inline int64_t Key(uint32_t node) const { return this->items[node].first; }
+	inline ParentSpriteToDraw *Sprite(uint32_t node) const { return this->items[node].second; }
+
+	/**
+	 * Remove the node following the given node.
+	 * @param node The node before the one to remove.
+	 * @return The node now following  node.
+	 */
+	inline uint32_t EraseAfter(uint32_t node)
+	{
+		this->next[node] = this->next[this->next[node]];
+		return this->next[node];
+	}
+
+private:
+	std::vector<std::pair<int64_t, ParentSpriteToDraw *>> items; ///< Sorting key and sprite of every node.
+	std::vector<uint32_t> next; ///< Index of the following node for every node.
+};
+
 /** Type for method for checking whether a viewport sprite sorter exists. */
 typedef bool (*VpSorterChecker)();
 /** Type for the actual viewport sprite sorter. */
@@ -3273,8 +3273,12 @@ void Window::InvalidateData(int data, bool gui_scope)
 {
 	this->SetDirty();
 	if (!gui_scope) {
-		/* Schedule GUI-scope invalidation for next redraw. */
-		this->scheduled_invalidation_data.push_back(data);
+		/* Schedule GUI-scope invalidation for next redraw.
+		 * The game loop often invalidates the same window with the same data many times in a row;
+		 * when processed together in GUI scope those repeated calls have no further effect. */
+		if (this->scheduled_invalidation_data.empty() || this->scheduled_invalidation_data.back() != data) {
+			this->scheduled_invalidation_data.push_back(data);
+		}
 	}
 	this->OnInvalidateData(data, gui_scope);
 }
@@ -0,0 +1,89 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file worker_pool.cpp Implementation of the pool of worker threads. */
+
+#include "stdafx.h"
+#include "worker_pool.h"
+#include "thread.h"
+
+#include "safeguards.h"
+
+/**
+ * Get the number of workers to use when none is configured.
+ * @return Number of hardware threads, but at least one.
+ */
+/* static */ uint WorkerPool::GetDefaultWorkerCount()
+{
+	return std::max(1U, std::thread::hardware_concurrency());
+}
+
+/**
+ * Start the worker threads. Does nothing if the pool is already running.
+ * @param workers Number of threads to start.
+ */
+void WorkerPool::Start(uint workers)
+{
+	if (this->IsRunning()) return;
+	this->stopping = false;
+	for (uint i = 0; i < workers; i++) {
+		std::thread t;
+		if (!StartNewThread(&t, this->name, [this]() { this->WorkerLoop(); })) break;
+		this->workers.push_back(std::move(t));
+	}
+}
+
+/**
+ * Stop the worker threads after all queued tasks are finished.
+ */
+void WorkerPool::Stop()
+{
+	{
+		std::lock_guard<std::mutex> guard(this->lock);
+		this->stopping = true;
+	}
+	this->wakeup.notify_all();
+	for (auto &t : this->workers) t.join();
+	this->workers.clear();
+}
+
+/**
+ * Queue a task to be run on one of the workers.
+ * @param task Task to run.
+ * @return Future that becomes ready once the task has finished.
+ */
+std::future<void> WorkerPool::Submit(Task &&task)
+{
+	std::packaged_task<void()> pt(std::move(task));
+	std::future<void> res = pt.get_future();
+	if (!this->IsRunning()) {
+		pt();
+		return res;
+	}
+	{
+		std::lock_guard<std::mutex> guard(this->lock);
+		this->queue.push_back(std::move(pt));
+	}
+	this->wakeup.notify_one();
+	return res;
+}
+
+/** Main loop of a worker thread. */
+void WorkerPool::WorkerLoop()
+{
+	for (;;) {
+		std::packaged_task<void()> task;
+		{
+			std::unique_lock<std::mutex> guard(this->lock);
+			this->wakeup.wait(guard, [this]() { return this->stopping || !this->queue.empty(); });
+			if (this->queue.empty()) return;
+			task = std::move(this->queue.front());
+			this->queue.pop_front();
+		}
+		task();
+	}
+}
@@ -0,0 +1,62 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file worker_pool.h Pool of worker threads running independent tasks. */
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Fixed number of threads taking tasks from a shared queue.
+ * Tasks must be independent of each other as no ordering between them is guaranteed.
+ * If no threads could be started, tasks are run immediately on the submitting thread.
+ */
+class WorkerPool {
+public:
+	using Task = std::function<void()>;
+
+	WorkerPool(std::string_view name) : name(name) {}
+	~WorkerPool() { this->Stop(); }
+
+	void Start(uint workers);
+	void Stop();
+	std::future<void> Submit(Task &&task);
+
+	/**
+	 * Check whether the pool has running workers.
+	 * @return True if tasks are run on worker threads.
+	 */
+	inline bool IsRunning() const { return !this->workers.empty(); }
+
+	/**
+	 * Get the number of worker threads.
+	 * @return Number of workers.
+	 */
+	inline uint GetWorkerCount() const { return static_cast<uint>(this->workers.size()); }
+
+	static uint GetDefaultWorkerCount();
+
+private:
+	void WorkerLoop();
+
+	std::string name; ///< Name of the worker threads.
+	std::vector<std::thread> workers; ///< The worker threads.
+	std::deque<std::packaged_task<void()>> queue; ///< Tasks waiting for a worker.
+	std::mutex lock; ///< Lock protecting #queue and #stopping.
+	std::condition_variable wakeup; ///< Signalled when a task is queued or the pool is stopped.
+	bool stopping = false; ///< Whether the workers should exit once the queue is empty.
+};
+
+#endif /* WORKER_POOL_H */